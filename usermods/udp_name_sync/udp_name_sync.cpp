@@ -41,23 +41,27 @@ class UdpNameSync : public Usermod {
       udpOut[0] = kPacketType; // custom usermod packet type (avoid 0..5 used by core protocols)
 
       if (segmentName[0] != '\0' && !mainseg.name) { // name cleared
-        notifierUdp.beginPacket(broadcastIp, udpPort);
         segmentName[0] = '\0';
         DEBUG_PRINTLN(F("UdpNameSync: sending empty name"));
         udpOut[1] = 0; // explicit empty string
+        lockUdpSockets();
+        notifierUdp.beginPacket(broadcastIp, udpPort);
         notifierUdp.write(udpOut, 2);
         notifierUdp.endPacket();
+        unlockUdpSockets();
         return;
       }
 
-      notifierUdp.beginPacket(broadcastIp, udpPort);
       DEBUG_PRINT(F("UdpNameSync: saving segment name "));
       DEBUG_PRINTLN(curName);
       strlcpy(segmentName, curName, sizeof(segmentName));
       strlcpy((char *)&udpOut[1], segmentName, sizeof(udpOut) - 1); // leave room for header byte
       size_t nameLen = strnlen((char *)&udpOut[1], sizeof(udpOut) - 1);
+      lockUdpSockets();
+      notifierUdp.beginPacket(broadcastIp, udpPort);
       notifierUdp.write(udpOut, 2 + nameLen);
       notifierUdp.endPacket();
+      unlockUdpSockets();
       DEBUG_PRINT(F("UdpNameSync: Sent segment name : "));
       DEBUG_PRINTLN(segmentName);
       return;
@@ -17,6 +17,11 @@
 #include "colors.h"
 #include "prng.h"
 
+// effects draw random numbers through fx_random*() so they can be rendered deterministically (see FX.h)
+#define hw_random   fx_random
+#define hw_random8  fx_random8
+#define hw_random16 fx_random16
+
 #define FX_FALLBACK_STATIC { mode_static(); return; }
 
 #if !(defined(WLED_DISABLE_PARTICLESYSTEM2D) && defined(WLED_DISABLE_PARTICLESYSTEM1D))
@@ -19,6 +19,7 @@
 #include <vector>
 #include "wled.h"
 #include "colors.h"
+#include "prng.h"
 #ifdef WLED_DEBUG
   // enable additional debug output
   #if defined(WLED_DEBUG_HOST)
@@ -57,6 +58,20 @@
 extern bool realtimeRespectLedMaps; // used in getMappedPixelIndex()
 extern byte realtimeMode;           // used in getMappedPixelIndex()
 
+// random numbers for effects (FX.cpp redirects hw_random*() here): hardware RNG, or while rendering deterministically
+// a PRNG seeded with the shared frame number and segment so synchronized nodes render identical frames (see service())
+extern PRNG fxRandom;
+extern bool fxRandomSeeded;
+inline uint32_t fx_random()                                          { return fxRandomSeeded ? (uint32_t(fxRandom.random16()) << 16) | fxRandom.random16() : hw_random(); }
+inline uint32_t fx_random(uint32_t upperlimit)                       { return (uint64_t(fx_random()) * upperlimit) >> 32; }
+inline int32_t  fx_random(int32_t lowerlimit, int32_t upperlimit)    { return lowerlimit >= upperlimit ? lowerlimit : lowerlimit + fx_random(uint32_t(upperlimit - lowerlimit)); }
+inline uint16_t fx_random16()                                        { return fxRandomSeeded ? fxRandom.random16() : hw_random16(); }
+inline uint16_t fx_random16(uint32_t upperlimit)                     { return (fx_random16() * upperlimit) >> 16; }
+inline int16_t  fx_random16(int32_t lowerlimit, int32_t upperlimit)  { int32_t range = upperlimit - lowerlimit; return lowerlimit + fx_random16(range); }
+inline uint8_t  fx_random8()                                         { return fxRandomSeeded ? fxRandom.random8() : hw_random8(); }
+inline uint8_t  fx_random8(uint32_t upperlimit)                      { return (fx_random8() * upperlimit) >> 8; }
+inline uint8_t  fx_random8(uint32_t lowerlimit, uint32_t upperlimit) { uint32_t range = upperlimit - lowerlimit; return lowerlimit + fx_random8(range); }
+
 /* Not used in all effects yet */
 #define WLED_FPS         42
 #define FRAMETIME_FIXED  (1000/WLED_FPS)
@@ -483,6 +498,7 @@ class Segment {
         bool    _manualW  : 1;
       };
     };
+    uint16_t _psParticles;            // effective number of particles used by a particle system FX (0 if not a PS FX), reported in JSON state
 
     // static variables are use to speed up effect calculations by stashing common pre-calculated values
     static unsigned      _usedSegmentData;    // amount of data used by all segments
@@ -591,6 +607,7 @@ class Segment {
     , _dataLen(0)
     , _default_palette(6)
     , _capabilities(0)
+    , _psParticles(0)
     , _t(nullptr)
     {
       DEBUGFX_PRINTF_P(PSTR("-- Creating segment: %p [%d,%d:%d,%d]\n"), this, (int)start, (int)stop, (int)startY, (int)stopY);
@@ -643,6 +660,8 @@ class Segment {
     inline uint16_t length()               const { return width() * height(); }               // segment length (count) in physical pixels
     inline uint16_t groupLength()          const { return grouping + spacing; }
     inline uint8_t  getLightCapabilities() const { return _capabilities; }
+    inline uint16_t getParticleCount()     const { return _psParticles; }
+    inline void     setParticleCount(unsigned n) { _psParticles = n; }
     inline void     deactivate()                 { setGeometry(0,0); }
     inline Segment &clearName()                  { p_free(name); name = nullptr; return *this; }
     inline Segment &setName(const String &name)  { return setName(name.c_str()); }
@@ -835,6 +854,10 @@ class WS2812FX {
       // true private variables
       _pixels(nullptr),
       _pixelCCT(nullptr),
+      _rtCanvas(nullptr),
+      _rtCanvasRetired(nullptr),
+      _rtCanvasW(0),
+      _rtCanvasH(0),
       _suspend(false),
       _brightness(DEFAULT_BRIGHTNESS),
       _length(DEFAULT_LED_COUNT),
@@ -853,7 +876,8 @@ class WS2812FX {
       customMappingTable(nullptr),
       customMappingSize(0),
       _lastShow(0),
-      _lastServiceShow(0)
+      _lastServiceShow(0),
+      _frameCounter(0)
     {
       _mode.reserve(_modeCount);     // allocate memory to prevent initial fragmentation (does not increase size())
       _modeData.reserve(_modeCount); // allocate memory to prevent initial fragmentation (does not increase size())
@@ -864,6 +888,8 @@ class WS2812FX {
     ~WS2812FX() {
       p_free(_pixels);
       p_free(_pixelCCT); // just in case
+      p_free(_rtCanvas);
+      p_free(_rtCanvasRetired);
       d_free(customMappingTable);
       _mode.clear();
       _modeData.clear();
@@ -895,6 +921,7 @@ class WS2812FX {
       waitForIt();                                // wait until frame is over (service() has finished or time for 1 frame has passed)
 
     void setRealtimePixelColor(unsigned i, uint32_t c);
+    void setRealtimePixelColors(unsigned start, const uint8_t *data, unsigned count, unsigned channels); // packed RGB/RGBW data
     inline void setPixelColor(unsigned n, uint32_t c) const   { if (n < getLengthTotal()) _pixels[n] = c; }  // paints absolute strip pixel with index n and color c
     inline void resetTimebase()                               { timebase = 0UL - millis(); }
     inline void setPixelColor(unsigned n, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) const
@@ -944,6 +971,7 @@ class WS2812FX {
 
     inline uint16_t getFps() const          { return (millis() - _lastShow > 2000) ? 0 : (FPS_MULTIPLIER * _cumulativeFps) >> FPS_CALC_SHIFT; } // Returns the refresh rate of the LED strip (_cumulativeFps is stored in fixed point)
     inline uint16_t getFrameTime() const    { return _frametime; }        // returns amount of time a frame should take (in ms)
+    inline unsigned long getFrameCounter() const { return _frameCounter; } // frame number of the effect clock (same on all synchronized nodes)
     inline uint16_t getMinShowDelay() const { return MIN_FRAME_DELAY; }   // returns minimum amount of time strip.service() can be delayed (constant)
     inline uint16_t getLength() const       { return _length; }           // returns actual amount of LEDs on a strip (2D matrix may have less LEDs than W*H)
     inline uint16_t getTransition() const   { return _transitionDur; }    // returns currently set transition time (in ms)
@@ -1014,6 +1042,10 @@ class WS2812FX {
   private:
     uint32_t *_pixels;
     uint8_t  *_pixelCCT;
+    uint32_t * volatile _rtCanvas; // realtime input canvas (if smaller than matrix and upscaled), written by receive tasks
+    uint32_t *_rtCanvasRetired;    // canvas unpublished in the previous frame, freed in the next
+    uint16_t  _rtCanvasW;
+    uint16_t  _rtCanvasH;
     std::vector<Segment> _segments;
 
     volatile bool _suspend;
@@ -1043,11 +1075,16 @@ class WS2812FX {
 
     show_callback _callback;
 
+    inline uint32_t *getRealtimeCanvas() const { return _rtCanvas; }
+    void      updateRealtimeCanvas();
+    void      upscaleRealtimeCanvas() const;
+
     uint16_t* customMappingTable;
     uint16_t  customMappingSize;
 
     unsigned long _lastShow;
     unsigned long _lastServiceShow;
+    unsigned long _frameCounter;   // last rendered frame of the effect clock (shared frame boundaries)
 
     friend class Segment;
 };
@@ -31,6 +31,9 @@
 
 static_assert(MAX_NUM_SEGMENTS >= WLED_MAX_BUSSES, "Max segments must be at least max number of busses!");
 
+PRNG fxRandom;                // seeded per frame and segment when rendering deterministically
+bool fxRandomSeeded = false;  // fx_random*() draw from fxRandom instead of hardware RNG
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Segment class implementation
@@ -217,6 +220,7 @@ void Segment::resetIfRequired() {
   }
   if (pixels) for (size_t i = 0; i < length(); i++) pixels[i] = BLACK; // clear pixel buffer
   step = 0; call = 0; aux0 = 0; aux1 = 0;
+  _psParticles = 0;
   reset = false;
   #ifdef WLED_ENABLE_GIF
   endImagePlayback(this);
@@ -420,14 +424,25 @@ void Segment::beginDraw(uint16_t prog) {
 }
 
 // relies on WS2812FX::service() to call it for each frame
+// when rendering deterministically palettes are timed by the shared effect clock and generated from a PRNG seeded
+// with the change time, so synchronized nodes pick the same palettes (harmonic palettes then start from a seeded random
+// base instead of the palette currently shown, which differs between nodes that did not boot together)
 void Segment::handleRandomPalette() {
-  unsigned long now = millis();
+  unsigned long now = fxDeterministic ? strip.now : millis();
   uint16_t now_s = now / 1000; // we only need seconds (and @dedehai hated shift >> 10)
   now = (now_s)*1000 + (now % 1000); // ignore days (now is limited to 18 hours as now_s can only store 65535s ~ 18h 12min)
   if (now_s < Segment::_lastPaletteChange) Segment::_lastPaletteChange = 0; // handle overflow (will cause 2*randomPaletteChangeTime glitch at most)
   // is it time to generate a new palette?
   if (now_s > Segment::_lastPaletteChange + randomPaletteChangeTime) {
-    Segment::_newRandomPalette  = useHarmonicRandomPalette ? generateHarmonicRandomPalette(Segment::_randomPalette) : generateRandomPalette();
+    if (fxDeterministic) {
+      now_s -= now_s % (randomPaletteChangeTime + 1); // align change times of all nodes
+      fxRandom.setSeed(hashInt(now_s));
+      fxRandomSeeded = true;
+    }
+    if (!useHarmonicRandomPalette)  Segment::_newRandomPalette = generateRandomPalette();
+    else if (fxRandomSeeded)        Segment::_newRandomPalette = generateHarmonicRandomPalette(generateRandomPalette());
+    else                            Segment::_newRandomPalette = generateHarmonicRandomPalette(Segment::_randomPalette);
+    fxRandomSeeded = false;
     Segment::_lastPaletteChange = now_s;
     Segment::_nextPaletteBlend  = now; // starts blending immediately
   }
@@ -1282,6 +1297,7 @@ void WS2812FX::finalizeInit() {
 
   Segment::maxWidth  = _length;
   Segment::maxHeight = 1;
+  if (canvasLength > _length) Segment::maxWidth = canvasLength; // distributed rendering: strip shows a slice of a larger canvas (1D only)
 
   //segments are created in makeAutoSegments();
   DEBUG_PRINTLN(F("Loading custom palettes"));
@@ -1310,11 +1326,19 @@ void WS2812FX::service() {
   if (_triggered || _targetFps == FPS_UNLIMITED) timeToShow = true; // unlimited mode = no frametime; strip.trigger() can overrule timing
 
   now = nowUp + timebase;                               // common time base for all effects
+  const bool frameLock = (clockSyncFrames || fxDeterministic) && _targetFps != FPS_UNLIMITED;
+  if (frameLock) {                                      // render on frame boundaries of the (synchronized) effect clock
+    const unsigned long frame = now / _frametime;
+    timeToShow = _triggered || frame != _frameCounter;
+    now = frame * _frametime;
+  }
   if (!timeToShow) return;                              // too early for service
   if (_suspend || elapsed <= MIN_FRAME_DELAY) return;   // keep wifi alive - no matter if triggered or unlimited
 
   _isServicing = true;
   bool doShow = _triggered;    // true if ≥1 active segment was processed (and strip was not suspended mid-loop), or trigger received → triggers show()
+  fxRandomSeeded = frameLock && fxDeterministic; // same random numbers on all nodes rendering the same frame
+  const uint32_t frameSeed = now / _frametime;
   for (size_t i = 0; i < _segments.size(); i++) {
     Segment &seg = _segments[i];
     _segment_index = i;
@@ -1334,6 +1358,7 @@ void WS2812FX::service() {
         uint16_t prog = seg.progress();
         seg.beginDraw(prog);                // set up parameters for get/setPixelColor() (will also blend colors and palette if blend style is FADE)
         _currentSegment = &seg;             // set current segment for effect functions (SEGMENT & SEGENV)
+        if (fxRandomSeeded) fxRandom.setSeed(hashInt(frameSeed ^ (i << 24)));
         // workaround for on/off transition to respect blending style
         _mode[seg.mode]();                  // run new/current mode (needed for bri workaround)
         seg.call++;
@@ -1345,6 +1370,7 @@ void WS2812FX::service() {
           Segment::modeBlend(true);         // set flag for beginDraw() to blend colors and palette
           segO->beginDraw(prog);            // set up palette & colors (also sets draw dimensions), parent segment has transition progress
           _currentSegment = segO;           // set current segment
+          if (fxRandomSeeded) fxRandom.setSeed(hashInt(frameSeed ^ (i << 24) ^ 0x800000));
           // workaround for on/off transition to respect blending style
           _mode[segO->mode]();              // run old mode (needed for bri workaround; semaphore!!)
           segO->call++;                     // increment old mode run counter
@@ -1353,6 +1379,7 @@ void WS2812FX::service() {
       }
     }
   }
+  fxRandomSeeded = false;
   _segment_index = 0;     // segment index is only valid while effects are serviced
   _currentSegment = &_segments[0]; // safe fallback to prevent stale pointer - SEGMENT/SEGENV should not be used outside of the service loop
 
@@ -1363,6 +1390,7 @@ void WS2812FX::service() {
     yield();
     Segment::handleRandomPalette(); // slowly transition random palette; move it into for loop when each segment has individual random palette
     _lastServiceShow = nowUp; // update timestamp, for precise FPS control
+    _frameCounter = now / _frametime;
     show();
   }
   #ifdef WLED_DEBUG
@@ -1741,6 +1769,9 @@ void WS2812FX::show() {
     _pixelCCT = static_cast<uint8_t*>(allocate_buffer(totalLen * sizeof(uint8_t), BFRALLOC_PREFER_PSRAM)); // allocate CCT buffer if necessary, prefer PSRAM
   if (_pixelCCT) memset(_pixelCCT, 127, totalLen); // set neutral (50:50) CCT
 
+  updateRealtimeCanvas();
+  if (_rtCanvas && realtimeMode && realtimeOverride == REALTIME_OVERRIDE_NONE) upscaleRealtimeCanvas();
+
   if (realtimeMode == REALTIME_MODE_INACTIVE || useMainSegmentOnly || realtimeOverride > REALTIME_OVERRIDE_NONE) {
     // clear frame buffer
     memset(_pixels, 0, sizeof(uint32_t) * totalLen);
@@ -1754,21 +1785,31 @@ void WS2812FX::show() {
   show_callback callback = _callback;
   if (callback) callback(); // will call setPixelColor or setRealtimePixelColor
 
+  // distributed rendering: buses show this strip's slice of the virtual canvas (realtime data is not offset)
+  size_t first = 0;
+  if (!isMatrix && totalLen > _length) {
+    if (realtimeMode == REALTIME_MODE_INACTIVE || realtimeOverride) first = min(size_t(canvasOffset), totalLen - _length);
+    totalLen = _length;
+  }
+
   // paint actual pixels
   int oldCCT = Bus::getCCT(); // store original CCT value (since it is global)
   // when cctFromRgb is true we implicitly calculate WW and CW from RGB values (cct==-1)
   if (cctFromRgb) BusManager::setSegmentCCT(-1);
   // use color gamma correction if enabled, not in realtime mode with gamma disabled or currently overriding RT mode
   bool useGammaCorrection = gammaCorrectCol && !(realtimeMode && arlsDisableGammaCorrection && !realtimeOverride);
+  // single bus without per-pixel CCT or mapping: write whole frame directly into bus driver buffer
+  bool isMapped = customMappingSize > 0 && (realtimeMode == REALTIME_MODE_INACTIVE || realtimeRespectLedMaps);
+  bool painted  = !_pixelCCT && !isMapped && BusManager::setPixelColors(_pixels + first, totalLen, useGammaCorrection);
 
-  for (size_t i = 0; i < totalLen; i++) {
+  if (!painted) for (size_t i = 0; i < totalLen; i++) {
     // when correctWB is true setSegmentCCT() will convert CCT into K with which we can then
     // correct/adjust RGB value according to desired CCT value, it will still affect actual WW/CW ratio
     if (_pixelCCT) { // cctFromRgb already exluded at allocation
-      if (i == 0 || _pixelCCT[i-1] != _pixelCCT[i]) BusManager::setSegmentCCT(_pixelCCT[i], correctWB);
+      if (i == 0 || _pixelCCT[first+i-1] != _pixelCCT[first+i]) BusManager::setSegmentCCT(_pixelCCT[first+i], correctWB);
     }
 
-    uint32_t c = _pixels[i]; // need a copy, do not modify _pixels directly (no byte access allowed on ESP32)
+    uint32_t c = _pixels[first+i]; // need a copy, do not modify _pixels directly (no byte access allowed on ESP32)
     if (c > 0 && useGammaCorrection)
       c = gamma32(c); // apply gamma correction if enabled note: applying gamma after brightness has too much color loss
     BusManager::setPixelColor(getMappedPixelIndex(i), c);
@@ -1791,6 +1832,10 @@ void WS2812FX::show() {
 }
 
 void WS2812FX::setRealtimePixelColor(unsigned i, uint32_t c) {
+  if (uint32_t *canvas = getRealtimeCanvas()) {
+    if (i < unsigned(_rtCanvasW * _rtCanvasH)) canvas[i] = c;
+    return;
+  }
   if (useMainSegmentOnly) {
     const Segment &seg = getMainSegment();
     if (seg.isActive() && i < seg.length()) seg.setPixelColorRaw(i, c);
@@ -1799,6 +1844,100 @@ void WS2812FX::setRealtimePixelColor(unsigned i, uint32_t c) {
   }
 }
 
+// convert packed 8 bit RGB (channels = 3) or RGBW (channels = 4) data into 32 bit pixels
+static void WLED_O2_ATTR unpackRGBW32(uint32_t *dst, const uint8_t *src, unsigned count, unsigned channels) {
+  if (channels == 4) {
+    for (unsigned i = 0; i < count; i++, src += 4) dst[i] = RGBW32(src[0], src[1], src[2], src[3]);
+  } else {
+    for (unsigned i = 0; i < count; i++, src += 3) dst[i] = RGBW32(src[0], src[1], src[2], 0);
+  }
+}
+
+// bulk version of setRealtimePixelColor(), range is checked once and pixels outside are discarded
+void WS2812FX::setRealtimePixelColors(unsigned start, const uint8_t *data, unsigned count, unsigned channels) {
+  uint32_t *dst = _pixels;
+  unsigned len = getLengthTotal();
+  if (uint32_t *canvas = getRealtimeCanvas()) {
+    dst = canvas;
+    len = _rtCanvasW * _rtCanvasH;
+  } else if (useMainSegmentOnly) {
+    const Segment &seg = getMainSegment();
+    if (!seg.isActive()) return;
+    dst = seg.getPixels();
+    len = seg.length();
+  }
+  if (!dst || start >= len) return;
+  if (count > len - start) count = len - start;
+  unpackRGBW32(dst + start, data, count, channels);
+}
+
+// canvas for realtime data if the sender streams a smaller resolution than the matrix (nullptr if 1:1)
+// it is only allocated and freed here (main loop): it is created when realtime mode starts and keeps its size until
+// realtime mode ends, then it is unpublished and freed one frame later so a receive task still writing can finish
+void WS2812FX::updateRealtimeCanvas() {
+  p_free(_rtCanvasRetired);
+  _rtCanvasRetired = nullptr;
+  const unsigned w = realtimeCanvasWidth, h = realtimeCanvasHeight;
+  const bool useCanvas = realtimeMode && isMatrix && w && h;
+  if (useCanvas == (_rtCanvasW != 0)) return; // nothing to do (allocation is not retried during a realtime session)
+  if (!useCanvas) {
+    _rtCanvasRetired = _rtCanvas;
+    _rtCanvas = nullptr; // unpublish before size is cleared
+    _rtCanvasW = _rtCanvasH = 0;
+    return;
+  }
+  uint32_t *canvas = static_cast<uint32_t*>(allocate_buffer(w * h * sizeof(uint32_t), BFRALLOC_PREFER_PSRAM | BFRALLOC_NOBYTEACCESS | BFRALLOC_CLEAR));
+  _rtCanvasW = w;
+  _rtCanvasH = h;
+  _rtCanvas = canvas; // publish after size is set, realtime data is applied 1:1 if allocation failed
+}
+
+// scale realtime canvas to matrix (or main segment) using nearest neighbour or bilinear filtering, 16.16 fixed point
+void WLED_O2_ATTR WS2812FX::upscaleRealtimeCanvas() const {
+  uint32_t *dst = _pixels;
+  unsigned dw = Segment::maxWidth;
+  unsigned dh = Segment::maxHeight;
+  if (useMainSegmentOnly) {
+    const Segment &seg = getMainSegment();
+    if (!seg.isActive()) return;
+    dst = seg.getPixels();
+    dw = seg.width();
+    dh = seg.height();
+  }
+  if (!dst || !dw || !dh) return;
+  const unsigned sw = _rtCanvasW, sh = _rtCanvasH;
+  const uint32_t stepX = (sw << 16) / dw;
+  const uint32_t stepY = (sh << 16) / dh;
+
+  if (!realtimeCanvasBilinear) {
+    for (unsigned y = 0, fy = stepY >> 1; y < dh; y++, fy += stepY) {
+      const uint32_t *src = _rtCanvas + (fy >> 16) * sw;
+      for (unsigned x = 0, fx = stepX >> 1; x < dw; x++, fx += stepX) *dst++ = src[fx >> 16];
+    }
+    return;
+  }
+
+  // sample at pixel centers, clamp at canvas edges
+  const int maxX = (sw - 1) << 16;
+  const int maxY = (sh - 1) << 16;
+  for (unsigned y = 0; y < dh; y++) {
+    const int fy = constrain(int(y * stepY + (stepY >> 1)) - 0x8000, 0, maxY);
+    const unsigned iy = fy >> 16;
+    const uint32_t *row0 = _rtCanvas + iy * sw;
+    const uint32_t *row1 = iy + 1 < sh ? row0 + sw : row0;
+    const uint8_t wy = fy >> 8;
+    for (unsigned x = 0; x < dw; x++) {
+      const int fx = constrain(int(x * stepX + (stepX >> 1)) - 0x8000, 0, maxX);
+      const unsigned ix0 = fx >> 16;
+      const unsigned ix1 = ix0 + 1 < sw ? ix0 + 1 : ix0;
+      const uint8_t wx = fx >> 8;
+      const uint32_t top = color_blend(row0[ix0], row0[ix1], wx);
+      const uint32_t bot = color_blend(row1[ix0], row1[ix1], wx);
+      *dst++ = color_blend(top, bot, wy);
+    }
+  }
+}
+
 // reset all segments
 void WS2812FX::restartRuntime() {
   suspend();
@@ -1955,7 +2094,7 @@ Segment& WS2812FX::getSegment(unsigned id) {
 void WS2812FX::resetSegments() {
   if (isServicing()) return;
   _segments.clear();          // destructs all Segment as part of clearing
-  _segments.emplace_back(0, isMatrix ? Segment::maxWidth : _length, 0, isMatrix ? Segment::maxHeight : 1);
+  _segments.emplace_back(0, Segment::maxWidth, 0, isMatrix ? Segment::maxHeight : 1); // maxWidth is _length (or canvas) in 1D
   if(_segments.size() == 0) {
     _segments.emplace_back(); // if out of heap, create a default segment
     errorFlag = ERR_NORAM_PX;
@@ -2030,7 +2169,7 @@ void WS2812FX::makeAutoSegments(bool forceReset) {
       #ifndef WLED_DISABLE_2D
       _segments[i].setGeometry(0, Segment::maxWidth, 1, 0, 0xFFFF, 0, Segment::maxHeight);
       #else
-      _segments[i].setGeometry(0, _length);
+      _segments[i].setGeometry(0, Segment::maxWidth);
       #endif
     }
   }
@@ -2056,8 +2195,8 @@ void WS2812FX::fixInvalidSegments() {
       if (_segments[i].stopY >  Segment::maxHeight) _segments[i].stopY = Segment::maxHeight;
     #endif
     } else {
-      if (_segments[i].start >= _length) { _segments.erase(_segments.begin()+i); continue; }
-      if (_segments[i].stop  >  _length) _segments[i].stop = _length;
+      if (_segments[i].start >= Segment::maxWidth) { _segments.erase(_segments.begin()+i); continue; }
+      if (_segments[i].stop  >  Segment::maxWidth) _segments[i].stop = Segment::maxWidth;
     }
   }
   // if any segments were deleted free memory
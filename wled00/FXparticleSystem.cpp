@@ -14,10 +14,17 @@
 
 #if !(defined(WLED_DISABLE_PARTICLESYSTEM2D) && defined(WLED_DISABLE_PARTICLESYSTEM1D)) // not both disabled
 #include "FXparticleSystem.h"
+
+// particles draw random numbers through fx_random*() so they can be rendered deterministically (see FX.h)
+#define hw_random   fx_random
+#define hw_random8  fx_random8
+#define hw_random16 fx_random16
+
 // local shared functions (used both in 1D and 2D system)
 static int32_t calcForce_dv(const int8_t force, uint8_t &counter);
 static bool checkBoundsAndWrap(int32_t &position, const int32_t max, const int32_t particleradius, const bool wrap); // returns false if out of bounds by more than particleradius
 static uint32_t fast_color_scaleAdd(const uint32_t c1, const uint32_t c2, uint8_t scale = 255); // fast and accurate color adding with scaling (scales c2 before adding)
+static uint32_t calcBudgetParticles(uint32_t limit, const uint32_t used, const uint32_t maxparticles, const uint32_t elapsed); // particle limit to hold the frame time budget
 #endif
 
 #ifndef WLED_DISABLE_PARTICLESYSTEM2D
@@ -26,6 +33,8 @@ ParticleSystem2D::ParticleSystem2D(uint32_t width, uint32_t height, uint32_t num
   numSources = numberofsources; // number of sources allocated in init
   numParticles = numberofparticles; // number of particles allocated in init
   usedParticles = numParticles; // use all particles by default
+  requestedParticles = numParticles;
+  budgetParticles = numParticles;
   advPartProps = nullptr; //make sure we start out with null pointers (just in case memory was not cleared)
   advPartSize = nullptr;
   setMatrixSize(width, height);
@@ -54,6 +63,7 @@ ParticleSystem2D::ParticleSystem2D(uint32_t width, uint32_t height, uint32_t num
 
 // update function applies gravity, moves the particles, handles collisions and renders the particles
 void ParticleSystem2D::update(void) {
+  const uint32_t starttime = micros();
   //apply gravity globally if enabled
   if (particlesettings.useGravity)
     applyGravity();
@@ -77,18 +87,22 @@ void ParticleSystem2D::update(void) {
   }
 
   render();
+  applyFrameBudget(starttime);
 }
 
 // update function for fire animation
 void ParticleSystem2D::updateFire(const uint8_t intensity) {
+  const uint32_t starttime = micros();
   fireParticleupdate();
   fireIntesity = intensity > 0 ? intensity : 1; // minimum of 1, zero checking is used in render function
   render();
+  applyFrameBudget(starttime);
 }
 
 // set percentage of used particles as uint8_t i.e 127 means 50% for example
 void ParticleSystem2D::setUsedParticles(uint8_t percentage) {
-  usedParticles = max((uint32_t)1, (numParticles * ((int)percentage+1)) >> 8); // number of particles to use (percentage is 0-255, 255 = 100%)
+  requestedParticles = max((uint32_t)1, (numParticles * ((int)percentage+1)) >> 8); // number of particles to use (percentage is 0-255, 255 = 100%)
+  usedParticles = min(requestedParticles, budgetParticles); // limit to what fits into the frame time budget
   PSPRINT(" SetUsedpaticles: allocated particles: ");
   PSPRINT(numParticles);
   PSPRINT(" ,used particles: ");
@@ -1010,6 +1024,13 @@ void WLED_O2_ATTR ParticleSystem2D::collideParticles(PSparticle &particle1, PSpa
     }
 }
 
+// adapt number of used particles to the time the update took, limits are applied in the next frame
+void ParticleSystem2D::applyFrameBudget(const uint32_t starttime) {
+  budgetParticles = calcBudgetParticles(budgetParticles, usedParticles, numParticles, micros() - starttime);
+  usedParticles = min(requestedParticles, budgetParticles);
+  SEGMENT.setParticleCount(usedParticles); // report effective particle count in JSON state
+}
+
 // update size and pointers (memory location and size can change dynamically)
 // note: do not access the PS class in FX befor running this function (or it messes up SEGENV.data)
 void ParticleSystem2D::updateSystem(void) {
@@ -1142,6 +1163,8 @@ ParticleSystem1D::ParticleSystem1D(uint32_t length, uint32_t numberofparticles,
   numSources = numberofsources;
   numParticles = numberofparticles; // number of particles allocated in init
   usedParticles = numParticles; // use all particles by default
+  requestedParticles = numParticles;
+  budgetParticles = numParticles;
   advPartProps = nullptr; //make sure we start out with null pointers (just in case memory was not cleared)
   //advPartSize = nullptr;
   setSize(length);
@@ -1152,12 +1175,14 @@ ParticleSystem1D::ParticleSystem1D(uint32_t length, uint32_t numberofparticles,
   motionBlur = 0; //no fading by default
   smearBlur = 0; //no smearing by default
   emitIndex = 0;
-  collisionStartIdx = 0;
   // initialize some default non-zero values most FX use
   for (uint32_t i = 0; i < numSources; i++) {
     sources[i].source.ttl = 1; //set source alive
     sources[i].sourceFlags.asByte = 0; // all flags disabled
   }
+  for (uint32_t i = 0; i < numParticles; i++) {
+    sortedIndex[i] = i; // start with identity order, sorting is done incrementally in handleCollisions()
+  }
   perParticleSize = isadvanced; // enable per particle size by default so FX do not need to set this explicitly. FX can disable by setting global size.
   if (isadvanced) {
     for (uint32_t i = 0; i < numParticles; i++) {
@@ -1168,6 +1193,7 @@ ParticleSystem1D::ParticleSystem1D(uint32_t length, uint32_t numberofparticles,
 
 // update function applies gravity, moves the particles, handles collisions and renders the particles
 void ParticleSystem1D::update(void) {
+  const uint32_t starttime = micros();
   //apply gravity globally if enabled
   if (particlesettings.useGravity) //note: in 1D system, applying gravity after collisions also works but may be worse
     applyGravity();
@@ -1192,11 +1218,13 @@ void ParticleSystem1D::update(void) {
   }
 
   render();
+  applyFrameBudget(starttime);
 }
 
 // set percentage of used particles as uint8_t i.e 127 means 50% for example
 void ParticleSystem1D::setUsedParticles(const uint8_t percentage) {
-  usedParticles =  max((uint32_t)1, (numParticles * ((int)percentage+1)) >> 8); // number of particles to use (percentage is 0-255, 255 = 100%)
+  requestedParticles = max((uint32_t)1, (numParticles * ((int)percentage+1)) >> 8); // number of particles to use (percentage is 0-255, 255 = 100%)
+  usedParticles = min(requestedParticles, budgetParticles); // limit to what fits into the frame time budget
   PSPRINT(" SetUsedpaticles: allocated particles: ");
   PSPRINT(numParticles);
   PSPRINT(" ,used particles: ");
@@ -1606,65 +1634,58 @@ void WLED_O2_ATTR ParticleSystem1D::renderLargeParticle(const uint32_t size, con
   }
 }
 
+// sort the particle index array by position using insertion sort
+// particles that do not take part in collisions are moved to the end of the array (using INT32_MAX as sort key)
+// particle order in 1D barely changes between frames, so the array is nearly sorted and this runs in almost O(n)
+// note: sorts all allocated particles (not just usedParticles) so the array always stays a valid permutation
+uint32_t WLED_O2_ATTR ParticleSystem1D::sortParticlesByPosition() {
+  const uint32_t used = usedParticles;
+  auto sortKey = [&](uint32_t idx) -> int32_t {
+    if (idx < used && particles[idx].ttl > 0 && particleFlags[idx].outofbounds == 0 && particleFlags[idx].collide)
+      return particles[idx].x;
+    return INT32_MAX; // not colliding, sort to the end
+  };
+
+  uint32_t numColliding = 0;
+  for (uint32_t i = 0; i < numParticles; i++) {
+    const uint16_t idx = sortedIndex[i];
+    const int32_t key = sortKey(idx);
+    if (key != INT32_MAX) numColliding++;
+    uint32_t j = i;
+    while (j > 0 && sortKey(sortedIndex[j - 1]) > key) { // shift larger entries up (usually zero or very few steps)
+      sortedIndex[j] = sortedIndex[j - 1];
+      j--;
+    }
+    sortedIndex[j] = idx;
+  }
+  return numColliding;
+}
+
 // detect collisions in an array of particles and handle them
+// uses sort-and-sweep: particles are kept sorted by position, in 1D only neighbouring particles can collide
 void ParticleSystem1D::handleCollisions() {
   uint32_t collisiondistance = particleHardRadius << 1; // twice the radius is min distance between colliding particles
   uint32_t checkDistSq = max(2 * PS_P_MAXSPEED, (int)collisiondistance);
   if (perParticleSize && advPartProps != nullptr) // using individual particle size
     checkDistSq = max(2 * PS_P_MAXSPEED, (512 * 52) >> 6); // max possible collision distance that catches all collisons
   checkDistSq = checkDistSq * checkDistSq; // square it for distance comparison (faster than abs() )
-  // note: partices are binned by position, assumption is that no more than half of the particles are in the same bin
-  // if they are, collisionStartIdx is increased so each particle collides at least every second frame (which still gives decent collisions)
-  int binWidth = 64 * PS_P_RADIUS_1D; // width of each bin, a compromise between speed and accuracy
-  int32_t overlap = collisiondistance + (2 * PS_P_MAXSPEED); // overlap bins to include edge particles to neighbouring bins (+ look-ahead of speed)
-  if (perParticleSize && advPartProps != nullptr) //may be using individual particle size
-    overlap = 512; // 2 * max radius, enough to catch all collisions even at full speed
-  uint32_t maxBinParticles = max((uint32_t)50, (usedParticles + 1) / 4); // do not bin small amounts, limit max to 1/4 of particles
-  uint32_t numBins = (maxX + (binWidth - 1)) / binWidth; // calculate number of bins
-  if (usedParticles < maxBinParticles) {
-    numBins = 1; // use single bin for small number of particles
-    binWidth = maxX + 1;
-  }
-  uint16_t binIndices[maxBinParticles]; // array to store indices of particles in a bin
-  uint32_t binParticleCount; // number of particles in the current bin
-  uint32_t nextFrameStartIdx = hw_random16(usedParticles); // index of the first particle in the next frame (set to fixed value if bin overflow)
-  uint32_t pidx = collisionStartIdx; //start index in case a bin is full, process remaining particles next frame
-  for (uint32_t bin = 0; bin < numBins; bin++) {
-    binParticleCount = 0; // reset for this bin
-    int32_t binStart = bin * binWidth - overlap; // note: first bin will extend to negative, but that is ok as out of bounds particles are ignored
-    int32_t binEnd = binStart + binWidth + (overlap << 1); // add twice the overlap as start is start-overlap, note: last bin can be out of bounds, see above
 
-    // fill the binIndices array for this bin
-    for (uint32_t i = 0; i < usedParticles; i++) {
-      if (particles[pidx].ttl > 0) { // alivee
-        if (particles[pidx].x >= binStart && particles[pidx].x <= binEnd) { // >= and <= to include particles on the edge of the bin (overlap to ensure boarder particles collide with adjacent bins)
-          if (particleFlags[pidx].outofbounds == 0 && particleFlags[pidx].collide) { // particle is in frame and does collide note: checking flags is quite slow and usually these are set, so faster to check here
-            if (binParticleCount >= maxBinParticles) { // bin is full, more particles in this bin so do the rest next frame
-              nextFrameStartIdx = pidx; // bin overflow can only happen once as bin size is at least half of the particles (or half +1)
-              break;
-            }
-            binIndices[binParticleCount++] = pidx;
-          }
-        }
-      }
-      pidx++;
-      if (pidx >= usedParticles) pidx = 0; // wrap around
-    }
-
-    for (uint32_t i = 0; i < binParticleCount; i++) { // go though all 'higher number' particles and see if any of those are in close proximity and if they are, make them collide
-      uint32_t idx_i = binIndices[i];
-      for (uint32_t j = i + 1; j < binParticleCount; j++) { // check against higher number particles
-        uint32_t idx_j = binIndices[j];
-        int32_t dx = particles[idx_j].x - particles[idx_i].x; // distance between particles
-        uint32_t dx_sq = dx * dx; // square distance (faster than abs() and works the same)
-        if (dx_sq <= checkDistSq) { // possible collision imminent, check properly note: this is slower than using direct speed look-ahead (like in 2D) but more accurate and fast enough for 1D
-          collideParticles(idx_i, idx_j, dx, collisiondistance); // handle the collision
-        }
-      }
+  const uint32_t numColliding = sortParticlesByPosition();
+  if (numColliding < 2) return;
+  // alternate sweep direction every frame to avoid pushing piles in one direction
+  const bool reverse = SEGMENT.call & 0x01;
+  for (uint32_t n = 0; n < numColliding - 1; n++) {
+    const uint32_t i = reverse ? numColliding - 2 - n : n;
+    const uint32_t idx_i = sortedIndex[i];
+    const uint32_t idx_j = sortedIndex[i + 1];
+    int32_t dx = particles[idx_j].x - particles[idx_i].x; // distance between neighbouring particles
+    uint32_t dx_sq = dx * dx; // square distance (faster than abs() and works the same)
+    if (dx_sq <= checkDistSq) { // possible collision imminent, check properly
+      collideParticles(idx_i, idx_j, dx, collisiondistance); // handle the collision
     }
   }
-  collisionStartIdx = nextFrameStartIdx; // set the start index for the next frame
 }
+
 // handle a collision if close proximity is detected, i.e. dx smaller than 2*radius + speed look-ahead
 void WLED_O2_ATTR ParticleSystem1D::collideParticles(uint32_t partIdx1, uint32_t partIdx2, int32_t dx, uint32_t collisiondistance) {
   int32_t massratio1 = 0; // 0 means dont use mass ratio (equal mass)
@@ -1757,6 +1778,13 @@ void WLED_O2_ATTR ParticleSystem1D::collideParticles(uint32_t partIdx1, uint32_t
   }
 }
 
+// adapt number of used particles to the time the update took, limits are applied in the next frame
+void ParticleSystem1D::applyFrameBudget(const uint32_t starttime) {
+  budgetParticles = calcBudgetParticles(budgetParticles, usedParticles, numParticles, micros() - starttime);
+  usedParticles = min(requestedParticles, budgetParticles);
+  SEGMENT.setParticleCount(usedParticles); // report effective particle count in JSON state
+}
+
 // update size and pointers (memory location and size can change dynamically)
 // note: do not access the PS class in FX befor running this function (or it messes up SEGENV.data)
 void ParticleSystem1D::updateSystem(void) {
@@ -1775,10 +1803,11 @@ void ParticleSystem1D::updatePSpointers(bool isadvanced) {
   particles = reinterpret_cast<PSparticle1D *>(this + 1); // pointer to particles
   particleFlags = reinterpret_cast<PSparticleFlags1D *>(particles + numParticles); // pointer to particle flags
   sources = reinterpret_cast<PSsource1D *>(particleFlags + numParticles); // pointer to source(s)
-  PSdataEnd = reinterpret_cast<uint8_t *>(sources + numSources);   // pointer to first available byte after the PS for FX additional data (already aligned to 4 byte boundary)
+  sortedIndex = reinterpret_cast<uint16_t *>(sources + numSources); // pointer to position sorted particle indices
+  PSdataEnd = reinterpret_cast<uint8_t *>(sortedIndex + numParticles);   // pointer to first available byte after the PS for FX additional data (numParticles is a multiple of 4 so this is aligned to 4 byte boundary)
 #ifndef WLED_DISABLE_2D
   if (SEGMENT.is2D() && SEGMENT.map1D2D) {
-    framebuffer = reinterpret_cast<uint32_t *>(sources + numSources); // use local framebuffer for 1D->2D mapping
+    framebuffer = reinterpret_cast<uint32_t *>(PSdataEnd); // use local framebuffer for 1D->2D mapping
     PSdataEnd = reinterpret_cast<uint8_t *>(framebuffer + SEGMENT.maxMappingLength()); // pointer to first available byte after the PS for FX additional data (still aligned to 4 byte boundary)
   }
   else
@@ -1831,6 +1860,7 @@ bool allocateParticleSystemMemory1D(const uint32_t numparticles, const uint32_t
   requiredmemory += sizeof(PSparticleFlags1D) * numparticles;
   requiredmemory += sizeof(PSparticle1D) * numparticles;
   requiredmemory += sizeof(PSsource1D) * numsources;
+  requiredmemory += sizeof(uint16_t) * numparticles; // sorted index array for collision detection
 #ifndef WLED_DISABLE_2D
   if (SEGMENT.is2D())
     requiredmemory += sizeof(uint32_t) * SEGMENT.maxMappingLength(); // need local buffer for mapped rendering
@@ -1898,6 +1928,19 @@ static int32_t calcForce_dv(const int8_t force, uint8_t &counter) {
   return dv;
 }
 
+// calculate the number of particles that can be updated within the frame time budget (psFrameBudget)
+// update and render time scales roughly linearly with the particle count
+static uint32_t calcBudgetParticles(uint32_t limit, const uint32_t used, const uint32_t maxparticles, const uint32_t elapsed) {
+  const uint32_t budget = psFrameBudget;
+  if (budget == 0)
+    return maxparticles; // no budget set, no limit
+  if (elapsed > budget) // over budget: reduce proportionally, at most by half per frame so a single slow frame does not kill all particles
+    limit = max((used * budget) / elapsed, used >> 1);
+  else if (elapsed < ((budget * 3) >> 2)) // well within budget (hysteresis to avoid oscillation): slowly increase
+    limit += (limit >> 4) + 1;
+  return constrain(limit, (uint32_t)1, maxparticles);
+}
+
 // check if particle is out of bounds and wrap it around if required, returns false if out of bounds
 static bool checkBoundsAndWrap(int32_t &position, const int32_t max, const int32_t particleradius, const bool wrap) {
   if ((uint32_t)position > (uint32_t)max) { // check if particle reached an edge, cast to uint32_t to save negative checking (max is always positive)
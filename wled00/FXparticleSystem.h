@@ -206,6 +206,7 @@ private:
   void collideParticles(PSparticle &particle1, PSparticle &particle2, int32_t dx, int32_t dy, const uint32_t collDistSq, int32_t massratio1, int32_t massratio2);
   void fireParticleupdate();
   //utility functions
+  void applyFrameBudget(const uint32_t starttime); // adapt usedParticles to hold the frame time budget
   void updatePSpointers(const bool isadvanced, const bool sizecontrol); // update the data pointers to current segment data space
   bool updateSize(PSadvancedParticle *advprops, PSsizeControl *advsize); // advanced size control
   void getParticleXYsize(PSadvancedParticle *advprops, PSsizeControl *advsize, uint32_t &xsize, uint32_t &ysize);
@@ -214,6 +215,8 @@ private:
   uint32_t *framebuffer; // frame buffer for rendering. note: using CRGBW as the buffer is slower, ESP compiler seems to optimize this better giving more consistent FPS
   PSsettings2D particlesettings; // settings used when updating particles (can also used by FX to move sources), do not edit properties directly, use functions above
   uint32_t numParticles;  // total number of particles allocated by this system
+  uint32_t requestedParticles; // number of particles requested by FX in setUsedParticles(), usedParticles can be lower to hold the frame time budget
+  uint32_t budgetParticles; // max number of particles that can be updated within the frame time budget (psFrameBudget)
   uint32_t emitIndex; // index to count through particles to emit so searching for dead pixels is faster
   int32_t collisionHardness;
   uint32_t wallHardness;
@@ -390,16 +393,21 @@ private:
   //paricle physics applied by system if flags are set
   void applyGravity(); // applies gravity to all particles
   void handleCollisions();
+  uint32_t sortParticlesByPosition(); // insertion sort of sortedIndex, returns number of colliding particles (sorted to the front)
   void collideParticles(uint32_t partIdx1, uint32_t partIdx2, int32_t dx, uint32_t collisiondistance);
 
   //utility functions
+  void applyFrameBudget(const uint32_t starttime); // adapt usedParticles to hold the frame time budget
   void updatePSpointers(const bool isadvanced); // update the data pointers to current segment data space
   //void updateSize(PSadvancedParticle *advprops, PSsizeControl *advsize); // advanced size control
   [[gnu::hot]] void bounce(int8_t &incomingspeed, int8_t &parallelspeed, int32_t &position, const uint32_t maxposition); // bounce on a wall
   // note: variables that are accessed often are 32bit for speed
   uint32_t *framebuffer; // frame buffer for rendering. note: using CRGBW as the buffer is slower, ESP compiler seems to optimize this better giving more consistent FPS
+  uint16_t *sortedIndex; // particle indices sorted by position (kept sorted across frames), used for sort-and-sweep collision detection
   PSsettings1D particlesettings; // settings used when updating particles
   uint32_t numParticles;  // total number of particles allocated by this system
+  uint32_t requestedParticles; // number of particles requested by FX in setUsedParticles(), usedParticles can be lower to hold the frame time budget
+  uint32_t budgetParticles; // max number of particles that can be updated within the frame time budget (psFrameBudget)
   uint32_t emitIndex; // index to count through particles to emit so searching for dead pixels is faster
   int32_t collisionHardness;
   uint32_t particleHardRadius; // hard surface radius of a particle, used for collision detection
@@ -407,7 +415,6 @@ private:
   uint8_t gforcecounter; // counter for global gravity
   int8_t gforce; // gravity strength, default is 8 (negative is allowed, positive is downwards)
   uint8_t forcecounter; // counter for globally applied forces
-  uint16_t collisionStartIdx; // particle array start index for collision detection
   //global particle properties for basic particles
   uint8_t particlesize; // global particle size, 0 = 1 pixel, 1 = 2 pixels, is overruled by advanced particle size
   uint8_t motionBlur; // enable motion blur, values > 100 gives smoother animations
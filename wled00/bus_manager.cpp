@@ -53,6 +53,7 @@ static ColorOrderMap _colorOrderMap = {};
 bool ColorOrderMap::add(uint16_t start, uint16_t len, uint8_t colorOrder) {
   if (count() >= WLED_MAX_COLOR_ORDER_MAPPINGS || len == 0 || (colorOrder & 0x0F) > COL_ORDER_MAX) return false; // upper nibble contains W swap information
   _mappings.push_back({start,len,colorOrder});
+  _version++;
   DEBUGBUS_PRINTF_P(PSTR("Bus: Add COM (%d,%d,%d)\n"), (int)start, (int)len, (int)colorOrder);
   return true;
 }
@@ -133,6 +134,10 @@ BusDigital::BusDigital(const BusConfig &bc)
 , _milliAmpsPerLed(bc.milliAmpsPerLed)
 , _milliAmpsMax(bc.milliAmpsMax)
 , _driverType(bc.driverType) // Store driver preference (0=RMT, 1=I2S)
+, _txStart(0)
+, _txTime(0)
+, _coMapVersion(0)
+, _coRunIdx(0)
 {
   DEBUGBUS_PRINTLN(F("Bus: Creating digital bus."));
   if (!isDigital(bc.type) || !bc.count) { DEBUGBUS_PRINTLN(F("Not digial or empty bus!")); return; }
@@ -160,6 +165,7 @@ BusDigital::BusDigital(const BusConfig &bc)
   if (bc.type == TYPE_WS2812_1CH_X3) lenToCreate = NUM_ICS_WS2812_1CH_3X(bc.count); // only needs a third of "RGB" LEDs for NeoPixelBus
   _busPtr = PolyBus::create(_iType, _pins, lenToCreate + _skip);
   _valid = (_busPtr != nullptr) && bc.count > 0;
+  if (_valid) compileColorOrderRuns();
   // fix for wled#4759
   if (_valid) for (unsigned i = 0; i < _skip; i++) {
     PolyBus::setPixelColor(_busPtr, _iType, i, 0, COL_ORDER_GRB); // set sacrificial pixels to black (CO does not matter here)
@@ -230,7 +236,7 @@ void BusDigital::applyBriLimit(uint8_t newBri) {
     unsigned hwLen = _len;
     if (_type == TYPE_WS2812_1CH_X3) hwLen = NUM_ICS_WS2812_1CH_3X(_len); // only needs a third of "RGB" LEDs for NeoPixelBus
     for (unsigned i = 0; i < hwLen; i++) {
-      uint8_t co = _colorOrderMap.getPixelColorOrder(i+_start, _colorOrder); // need to revert color order for correct color scaling and CCT calc in case white is swapped
+      uint8_t co = getColorOrderAt(i); // need to revert color order for correct color scaling and CCT calc in case white is swapped
       uint32_t c = PolyBus::getPixelColor(_busPtr, _iType, i, co); // Note: if ABL would be calculated as a seperate loop (as it was before) it is slower but could use original color, making it more color-accurate
       if (hasCCT()) {
         uint8_t cctWW, cctCW;
@@ -250,6 +256,8 @@ void BusDigital::show() {
   if (!_valid) return;
   _NPBbri = (_NPBbri * _bri) / 255;      // total applied brightness for use in restoreColorLossy (see applyBriLimit())
   PolyBus::show(_busPtr, _iType, _skip); // faster if buffer consistency is not important (no skipped LEDs)
+  if (_coMapVersion != _colorOrderMap.version()) compileColorOrderRuns(); // map was changed without recreating buses
+  _txStart = micros() | 1;               // RMT & I2S drivers return immediately, completion is detected in updateTransmitTime()
 }
 
 bool BusDigital::canShow() const {
@@ -257,11 +265,19 @@ bool BusDigital::canShow() const {
   return PolyBus::canShow(_busPtr, _iType);
 }
 
+// record completion of the last frame (polled from BusManager::show(), so the result is an upper bound)
+void BusDigital::updateTransmitTime() {
+  if (!_valid || !_txStart || !PolyBus::canShow(_busPtr, _iType)) return;
+  uint32_t elapsed = micros() - _txStart;
+  _txTime  = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+  _txStart = 0;
+}
+
 //If LEDs are skipped, it is possible to use the first as a status LED.
 //TODO only show if no new show due in the next 50ms
 void BusDigital::setStatusPixel(uint32_t c) {
   if (_valid && _skip) {
-    PolyBus::setPixelColor(_busPtr, _iType, 0, c, _colorOrderMap.getPixelColorOrder(_start, _colorOrder));
+    PolyBus::setPixelColor(_busPtr, _iType, 0, c, getColorOrderAt(0));
     if (canShow()) PolyBus::show(_busPtr, _iType);
   }
 }
@@ -293,7 +309,7 @@ void IRAM_ATTR BusDigital::setPixelColor(unsigned pix, uint32_t c) {
 
   if (_reversed) pix = _len - pix -1;
   pix += _skip;
-  const uint8_t co = _colorOrderMap.getPixelColorOrder(pix+_start, _colorOrder);
+  const uint8_t co = getColorOrderAt(pix);
   if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs
     unsigned pOld = pix;
     pix = IC_INDEX_WS2812_1CH_3X(pix);
@@ -308,12 +324,66 @@ void IRAM_ATTR BusDigital::setPixelColor(unsigned pix, uint32_t c) {
   PolyBus::setPixelColor(_busPtr, _iType, pix, c, co, wwcw);
 }
 
+// buffer position (0=G, 1=R, 2=B, 3=W) of R, G, B & W for given color order (see PolyBus::setPixelColor())
+static void getWirePositions(uint8_t co, uint8_t *pos) {
+  static const uint8_t wirePos[6][3] = {{1,0,2}, {0,1,2}, {1,2,0}, {0,2,1}, {2,1,0}, {2,0,1}};
+  const unsigned order = (co & 0x0F) < 6 ? (co & 0x0F) : 0;
+  pos[0] = wirePos[order][0];
+  pos[1] = wirePos[order][1];
+  pos[2] = wirePos[order][2];
+  pos[3] = 3;
+  const unsigned swapW = co >> 4; // 1 = swap W & B, 2 = swap W & G, 3 = swap W & R
+  if (swapW >= 1 && swapW <= 3) {
+    const uint8_t swapPos = swapW == 1 ? 2 : swapW - 2;
+    for (unsigned i = 0; i < 3; i++) if (pos[i] == swapPos) pos[i] = 3;
+    pos[3] = swapPos;
+  }
+}
+
+// writes whole bus (len must match bus length) directly into NeoPixelBus buffer, avoids per-pixel type & color order lookups
+// only plain 8 bit GRB(W) types without white balance correction are supported, returns false otherwise
+bool WLED_O2_ATTR BusDigital::setPixelColors(const uint32_t *c, size_t len, bool gamma) {
+  if (!_valid || len != _len || hasCCT() || _type == TYPE_WS2812_1CH_X3 || Bus::_cct >= 1900) return false;
+  uint8_t *buf = PolyBus::getPixelBuffer(_busPtr, _iType);
+  if (!buf) return false;
+
+  const unsigned channels = hasWhite() ? 4 : 3; // W channel (pos 3) is dropped on 3 channel buses
+  const bool useWhite = hasWhite();
+  const bool useABL = BusManager::_useABL;
+  const bool ws2815ABL = _milliAmpsPerLed == 255; // use max of RGB (see setPixelColor())
+  uint8_t cctWW = 0, cctCW = 0;
+
+  // walk color order runs in buffer order (h includes skipped pixels), color order is resolved once per run
+  unsigned h = _skip;
+  const unsigned hwEnd = _len + _skip;
+  for (const ColorOrderRun &run : _coRuns) {
+    if (run.end <= h) continue;
+    const unsigned runEnd = run.end < hwEnd ? run.end : hwEnd;
+    uint8_t pos[4];
+    getWirePositions(run.colorOrder, pos);
+    for (; h < runEnd; h++) {
+      uint32_t col = c[_reversed ? hwEnd - h - 1 : h - _skip];
+      if (col > 0 && gamma) col = gamma32(col);
+      if (useWhite) col = autoWhiteCalc(col, cctWW, cctCW);
+      col = color_fade(col, _bri, true); // apply brightness
+      uint8_t px[4] = {0, 0, 0, 0};
+      px[pos[0]] = R(col);
+      px[pos[1]] = G(col);
+      px[pos[2]] = B(col);
+      px[pos[3]] = W(col);
+      if (useABL) _colorSum += ws2815ABL ? max(max(R(col), G(col)), B(col)) : R(col) + G(col) + B(col) + W(col);
+      memcpy(buf + h * channels, px, channels);
+    }
+  }
+  return true;
+}
+
 // returns lossly restored color from bus
 uint32_t IRAM_ATTR BusDigital::getPixelColor(unsigned pix) const {
   if (!_valid) return 0;
   if (_reversed) pix = _len - pix -1;
   pix += _skip;
-  const uint8_t co = _colorOrderMap.getPixelColorOrder(pix+_start, _colorOrder);
+  const uint8_t co = getColorOrderAt(pix);
   uint32_t c = restoreColorLossy(PolyBus::getPixelColor(_busPtr, _iType, (_type==TYPE_WS2812_1CH_X3) ? IC_INDEX_WS2812_1CH_3X(pix) : pix, co),_NPBbri);
   if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs
     uint8_t r = R(c);
@@ -346,6 +416,53 @@ void BusDigital::setColorOrder(uint8_t colorOrder) {
   // upper nibble contains W swap information
   if ((colorOrder & 0x0F) > 5) return;
   _colorOrder = colorOrder;
+  compileColorOrderRuns();
+}
+
+// split bus into runs of equal color order so that no per-pixel search of the ColorOrderMap is needed
+// map entries use global pixel indices (incl. skipped pixels, as in setPixelColor()), first matching entry wins
+void BusDigital::compileColorOrderRuns() {
+  const unsigned hwLen = _len + _skip;
+  uint16_t bounds[2*WLED_MAX_COLOR_ORDER_MAPPINGS + 1];
+  unsigned n = 0;
+  bounds[n++] = 0;
+  for (unsigned m = 0; m < _colorOrderMap.count(); m++) {
+    const ColorOrderMapEntry *e = _colorOrderMap.get(m);
+    int s = (int)e->start - _start;
+    int t = s + e->len;
+    if (s > 0 && s < (int)hwLen) bounds[n++] = s;
+    if (t > 0 && t < (int)hwLen) bounds[n++] = t;
+  }
+  std::sort(bounds, bounds + n);
+
+  _coRuns.clear();
+  for (unsigned i = 0; i < n; i++) {
+    if (i > 0 && bounds[i] == bounds[i-1]) continue;
+    uint8_t co = _colorOrderMap.getPixelColorOrder(bounds[i] + _start, _colorOrder); // run start decides for whole run
+    if (!_coRuns.empty() && _coRuns.back().colorOrder == co) continue; // extend previous run
+    if (!_coRuns.empty()) _coRuns.back().end = bounds[i];
+    _coRuns.push_back({(uint16_t)hwLen, co});
+  }
+  _coRuns.shrink_to_fit();
+  _coRunIdx = 0;
+  _coMapVersion = _colorOrderMap.version();
+  DEBUGBUS_PRINTF_P(PSTR("Bus: %u color order run(s).\n"), _coRuns.size());
+}
+
+uint8_t IRAM_ATTR BusDigital::getColorOrderAt(unsigned pix) const {
+  if (_coRuns.empty()) return _colorOrder; // invalid bus
+  unsigned idx = _coRunIdx;
+  if (pix >= _coRuns[idx].end || (idx > 0 && pix < _coRuns[idx-1].end)) {
+    // binary search for first run ending after pix (pix beyond last run resolves to last run)
+    unsigned lo = 0, hi = _coRuns.size() - 1;
+    while (lo < hi) {
+      unsigned mid = (lo + hi) >> 1;
+      if (_coRuns[mid].end > pix) hi = mid;
+      else lo = mid + 1;
+    }
+    _coRunIdx = idx = lo;
+  }
+  return _coRuns[idx].colorOrder;
 }
 
 // credit @willmmiles & @netmindz https://github.com/wled/WLED/pull/4056
@@ -701,9 +818,36 @@ std::vector<LEDType> BusOnOff::getLEDTypes() {
   };
 }
 
+#ifdef ARDUINO_ARCH_ESP32
+std::atomic<uint32_t> BusNetwork::_framesDropped{0};
+uint8_t  BusNetwork::_maxQueueDepth = 0;
+
+static TaskHandle_t             netSendTask  = nullptr;
+static SemaphoreHandle_t        netSendMutex = nullptr; // guards netSendBuses, held while frames are sent
+static std::vector<BusNetwork*> netSendBuses;
+
+static void netSendTaskFn(void *) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100)); // woken by BusNetwork::show()
+    xSemaphoreTake(netSendMutex, portMAX_DELAY);
+    setRealtimePacing(true); // yield between packet bursts instead of sending all universes back to back
+    for (BusNetwork *bus : netSendBuses) bus->sendQueued();
+    setRealtimePacing(false);
+    xSemaphoreGive(netSendMutex);
+  }
+}
+#endif
+
 BusNetwork::BusNetwork(const BusConfig &bc)
 : Bus(bc.type, bc.start, bc.autoWhite, bc.count)
 , _broadcastLock(false)
+, _keyframe(true)
+, _reference(nullptr)
+, _streamSeq(0)
+, _sendLatency(0)
+, _e131Universe(bc.frequency)
+, _e131Universes(0)
+, _e131Seq(nullptr)
 {
   switch (bc.type) {
     case TYPE_NET_ARTNET_RGB:
@@ -715,6 +859,10 @@ BusNetwork::BusNetwork(const BusConfig &bc)
     case TYPE_NET_E131_RGB:
       _UDPtype = 1;
       break;
+    case TYPE_NET_WLED_RGB:
+    case TYPE_NET_WLED_RGBW:
+      _UDPtype = 3;
+      break;
     default: // TYPE_NET_DDP_RGB / TYPE_NET_DDP_RGBW
       _UDPtype = 0;
       break;
@@ -729,7 +877,28 @@ BusNetwork::BusNetwork(const BusConfig &bc)
   resolveHostname(); // resolve hostname to IP address if needed
   #endif
   _data = (uint8_t*)d_calloc(_len, _UDPchannels);
-  _valid = (_data != nullptr);
+  if (_UDPtype == 3) _reference = (uint8_t*)p_calloc(_len, _UDPchannels);
+  if (_UDPtype == 1) {
+    _e131Universes = (_len * _UDPchannels - 1) / (_hasWhite ? 512 : 510) + 1; // same split as realtimeBroadcastE131()
+    _e131Seq = (uint8_t*)p_calloc(_e131Universes, 1);
+  }
+  _valid = (_data != nullptr) && (_UDPtype != 3 || _reference != nullptr) && (_UDPtype != 1 || _e131Seq != nullptr);
+  #ifdef ARDUINO_ARCH_ESP32
+  _queueHead = _queueTail = 0;
+  _queue = _valid ? (uint8_t*)p_malloc(NET_QUEUE_LEN * _len * _UDPchannels) : nullptr;
+  if (_queue) {
+    if (!netSendMutex) netSendMutex = xSemaphoreCreateMutex();
+    if (netSendMutex && !netSendTask) xTaskCreateUniversal(netSendTaskFn, "NetBus", 4096, nullptr, 1, &netSendTask, 0);
+    if (netSendTask) {
+      xSemaphoreTake(netSendMutex, portMAX_DELAY);
+      netSendBuses.push_back(this);
+      xSemaphoreGive(netSendMutex);
+    } else {
+      p_free(_queue); // no sender task, fall back to sending from show()
+      _queue = nullptr;
+    }
+  }
+  #endif
   DEBUGBUS_PRINTF_P(PSTR("%successfully inited virtual strip with type %u and IP %u.%u.%u.%u\n"), _valid?"S":"Uns", bc.type, bc.pins[0], bc.pins[1], bc.pins[2], bc.pins[3]);
 }
 
@@ -753,9 +922,64 @@ uint32_t BusNetwork::getPixelColor(unsigned pix) const {
 
 void BusNetwork::show() {
   if (!_valid || !canShow()) return;
+  #ifdef ARDUINO_ARCH_ESP32
+  if (_queue) {
+    const unsigned head = _queueHead;
+    const unsigned next = (head + 1) % NET_QUEUE_LEN;
+    if (next == _queueTail) { _framesDropped++; return; } // sender congested, drop frame
+    const size_t frameSize = _len * _UDPchannels;
+    memcpy(_queue + head * frameSize, _data, frameSize);
+    _queueBri[head]  = _bri;
+    _queueTime[head] = micros();
+    _queueHead = next; // publish frame
+    const uint8_t depth = (next + NET_QUEUE_LEN - _queueTail) % NET_QUEUE_LEN;
+    if (depth > _maxQueueDepth) _maxQueueDepth = depth;
+    xTaskNotifyGive(netSendTask);
+    return;
+  }
+  #endif
+  const unsigned long start = micros();
   _broadcastLock = true;
-  realtimeBroadcast(_UDPtype, _client, _len, _data, _bri, hasWhite());
+  #ifdef ARDUINO_ARCH_ESP32
+  if (netSendMutex) xSemaphoreTake(netSendMutex, portMAX_DELAY); // realtimeBroadcast() packet buffer is shared with sender task
+  #endif
+  broadcast(_data, _bri);
+  #ifdef ARDUINO_ARCH_ESP32
+  if (netSendMutex) xSemaphoreGive(netSendMutex);
+  #endif
   _broadcastLock = false;
+  const uint32_t elapsed = micros() - start;
+  _sendLatency = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+void BusNetwork::sendQueued() {
+  const unsigned head = _queueHead;
+  unsigned tail = _queueTail;
+  if (head == tail) return; // nothing queued
+  const unsigned pending = (head + NET_QUEUE_LEN - tail) % NET_QUEUE_LEN;
+  if (pending > 1) { // only the newest frame is worth sending
+    _framesDropped += pending - 1;
+    tail = (head + NET_QUEUE_LEN - 1) % NET_QUEUE_LEN;
+  }
+  broadcast(_queue + tail * _len * _UDPchannels, _queueBri[tail]);
+  const uint32_t elapsed = micros() - _queueTime[tail];
+  _sendLatency = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+  _queueTail = (tail + 1) % NET_QUEUE_LEN; // release slot(s)
+}
+#endif
+
+void BusNetwork::broadcast(const uint8_t *data, uint8_t bri) {
+  if (_UDPtype == 1) {
+    realtimeBroadcastE131(_client, _e131Universe ? _e131Universe : e131OutUniverse, _e131Seq, _len, data, bri, hasWhite());
+    return;
+  }
+  if (_UDPtype != 3) {
+    realtimeBroadcast(_UDPtype, _client, _len, data, bri, hasWhite());
+    return;
+  }
+  const bool keyframe = _keyframe || _streamSeq % WLED_STREAM_KEY_INTERVAL == 0;
+  _keyframe = realtimeBroadcastDelta(_client, _len, data, _reference, _streamSeq++, keyframe, bri, hasWhite()) != 0;
 }
 
 size_t BusNetwork::getPins(uint8_t* pinArray) const {
@@ -791,6 +1015,9 @@ std::vector<LEDType> BusNetwork::getLEDTypes() {
   return {
     {TYPE_NET_DDP_RGB,     "N",     PSTR("DDP RGB (network)")},      // should be "NNNN" to determine 4 "pin" fields
     {TYPE_NET_ARTNET_RGB,  "N",     PSTR("Art-Net RGB (network)")},
+    {TYPE_NET_E131_RGB,    "N",     PSTR("E1.31 RGB (network)")},
+    {TYPE_NET_WLED_RGB,    "N",     PSTR("WLED delta RGB (network)")},
+    {TYPE_NET_WLED_RGBW,   "N",     PSTR("WLED delta RGBW (network)")},
     {TYPE_NET_DDP_RGBW,    "N",     PSTR("DDP RGBW (network)")},
     {TYPE_NET_ARTNET_RGBW, "N",     PSTR("Art-Net RGBW (network)")},
     // hypothetical extensions
@@ -803,8 +1030,21 @@ std::vector<LEDType> BusNetwork::getLEDTypes() {
 
 void BusNetwork::cleanup() {
   DEBUGBUS_PRINTLN(F("Virtual Cleanup."));
+  #ifdef ARDUINO_ARCH_ESP32
+  if (_queue) {
+    xSemaphoreTake(netSendMutex, portMAX_DELAY); // waits until sender task is done with this bus
+    netSendBuses.erase(std::remove(netSendBuses.begin(), netSendBuses.end(), this), netSendBuses.end());
+    xSemaphoreGive(netSendMutex);
+    p_free(_queue);
+    _queue = nullptr;
+  }
+  #endif
   d_free(_data);
   _data = nullptr;
+  p_free(_reference);
+  _reference = nullptr;
+  p_free(_e131Seq);
+  _e131Seq = nullptr;
   _type = I_NONE;
   _valid = false;
 }
@@ -1437,8 +1677,25 @@ void BusManager::off() {
 
 void BusManager::show() {
   applyABL(); // apply brightness limit, updates _gMilliAmpsUsed
-  for (auto &bus : busses) {
-    bus->show();
+  // start all idle buses first so RMT/I2S channels transmit concurrently, then start the ones still busy with the
+  // previous frame as soon as they are done: a busy bus no longer delays the buses after it (Show() would block)
+  uint32_t pending = 0; // bit mask of buses not yet started (WLED_MAX_BUSSES <= 32)
+  for (size_t i = 0; i < busses.size(); i++) {
+    busses[i]->updateTransmitTime();
+    if (busses[i]->canShow()) busses[i]->show();
+    else pending |= 1UL << i;
+  }
+  const unsigned long start = millis();
+  while (pending) {
+    for (size_t i = 0; i < busses.size(); i++) {
+      if (!(pending & (1UL << i))) continue;
+      busses[i]->updateTransmitTime();
+      if (busses[i]->canShow() || millis() - start > 100) { // timeout: let the driver block as it would without this loop
+        busses[i]->show();
+        pending &= ~(1UL << i);
+      }
+    }
+    if (pending) yield();
   }
 }
 
@@ -1449,6 +1706,12 @@ void IRAM_ATTR BusManager::setPixelColor(unsigned pix, uint32_t c) {
   }
 }
 
+// fast path for single bus layouts: pixel index equals bus index, bus writes its driver buffer directly
+bool BusManager::setPixelColors(const uint32_t *c, size_t len, bool gamma) {
+  if (busses.size() != 1 || busses[0]->getStart() != 0) return false;
+  return busses[0]->setPixelColors(c, len, gamma);
+}
+
 void BusManager::setSegmentCCT(int16_t cct, bool allowWBCorrection) {
   if (cct > 255) cct = 255;
   if (cct >= 0) {
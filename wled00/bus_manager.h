@@ -17,6 +17,7 @@
 #include "pin_manager.h"
 #include <vector>
 #include <memory>
+#include <atomic>
 #ifdef ARDUINO_ARCH_ESP32
 #include "asyncDNS.h"
 #endif
@@ -79,15 +80,23 @@ typedef struct {
   uint8_t colorOrder;
 } ColorOrderMapEntry;
 
+// Resolved color order for a run of bus pixels (compiled from ColorOrderMap per bus), run ends before pixel "end".
+typedef struct {
+  uint16_t end;
+  uint8_t colorOrder;
+} ColorOrderRun;
+
 struct ColorOrderMap {
     bool add(uint16_t start, uint16_t len, uint8_t colorOrder);
 
     inline uint8_t count() const { return _mappings.size(); }
+    inline uint8_t version() const { return _version; } // changes whenever mappings change (buses recompile their runs)
     inline void reserve(size_t num) { _mappings.reserve(num); }
 
     void reset() {
       _mappings.clear();
       _mappings.shrink_to_fit();
+      _version++;
     }
 
     const ColorOrderMapEntry* get(uint8_t n) const {
@@ -99,6 +108,7 @@ struct ColorOrderMap {
 
   private:
     std::vector<ColorOrderMapEntry> _mappings;
+    uint8_t _version = 0;
 };
 
 
@@ -130,8 +140,10 @@ class Bus {
     virtual void     begin()                                    {};
     virtual void     show()                                     = 0;
     virtual bool     canShow() const                            { return true; }
+    virtual void     updateTransmitTime()                       {} // called before show() to record completion of the previous frame
     virtual void     setStatusPixel(uint32_t c)                 {}
     virtual void     setPixelColor(unsigned pix, uint32_t c)    = 0;
+    virtual bool     setPixelColors(const uint32_t *c, size_t len, bool gamma) { return false; } // optional bulk write, returns false if not supported
     virtual void     setBrightness(uint8_t b)                   { _bri = b; };
     virtual void     setColorOrder(uint8_t co)                  {}
     virtual uint32_t getPixelColor(unsigned pix) const          { return 0; }
@@ -143,6 +155,7 @@ class Bus {
     virtual uint16_t getLEDCurrent() const                      { return 0; }
     virtual uint16_t getUsedCurrent() const                     { return 0; }
     virtual uint16_t getMaxCurrent() const                      { return 0; }
+    virtual uint16_t getTransmitTime() const                    { return 0; } // duration of last frame transmission in us (0 if unknown)
     virtual uint8_t  getDriverType() const                      { return 0; } // Default to RMT (0) for non-digital buses
     virtual size_t   getBusSize() const                         { return sizeof(Bus); } // currently unused
     virtual const String getCustomText() const                  { return String(); }
@@ -181,7 +194,8 @@ class Bus {
               type == TYPE_SK6812_RGBW || type == TYPE_TM1814 || type == TYPE_UCS8904 ||
               type == TYPE_FW1906 || type == TYPE_WS2805 || type == TYPE_SM16825 ||        // digital types with white channel
               (type > TYPE_ONOFF && type <= TYPE_ANALOG_5CH && type != TYPE_ANALOG_3CH) || // analog types with white channel
-              type == TYPE_NET_DDP_RGBW || type == TYPE_NET_ARTNET_RGBW;                   // network types with white channel
+              type == TYPE_NET_DDP_RGBW || type == TYPE_NET_ARTNET_RGBW ||                 // network types with white channel
+              type == TYPE_NET_WLED_RGBW;
     }
     static constexpr bool hasCCT(uint8_t type) {
       return  type == TYPE_WS2812_WWA    || type == TYPE_SM16825 ||
@@ -252,8 +266,10 @@ class BusDigital : public Bus {
 
     void show() override;
     bool canShow() const override;
+    void updateTransmitTime() override;
     void setStatusPixel(uint32_t c) override;
     [[gnu::hot]] void setPixelColor(unsigned pix, uint32_t c) override;
+    [[gnu::hot]] bool setPixelColors(const uint32_t *c, size_t len, bool gamma) override;
     void setColorOrder(uint8_t colorOrder) override;
     [[gnu::hot]] uint32_t getPixelColor(unsigned pix) const override;
     uint8_t  getColorOrder() const override  { return _colorOrder; }
@@ -263,6 +279,7 @@ class BusDigital : public Bus {
     uint16_t getLEDCurrent() const override  { return _milliAmpsPerLed; }
     uint16_t getUsedCurrent() const override { return _milliAmpsTotal; }
     uint16_t getMaxCurrent() const override  { return _milliAmpsMax; }
+    uint16_t getTransmitTime() const override { return _txTime; }
     uint8_t  getDriverType() const override  { return _driverType; }
     void     setCurrentLimit(uint16_t milliAmps) { _milliAmpsLimit = milliAmps; }
     void     estimateCurrent(); // estimate used current from summed colors
@@ -286,6 +303,14 @@ class BusDigital : public Bus {
     uint16_t _milliAmpsLimit;
     uint32_t _colorSum; // total color value for the bus, updated in setPixelColor(), used to estimate current
     void    *_busPtr;
+    uint32_t _txStart;         // micros() when last frame was handed to the driver, 0 once completion was recorded
+    uint16_t _txTime;          // measured transmit time of last frame in us (upper bound, completion is polled)
+    std::vector<ColorOrderRun> _coRuns; // color order runs covering all bus pixels (incl. skipped), sorted by end
+    uint8_t _coMapVersion;     // ColorOrderMap version _coRuns were compiled from
+    mutable uint8_t _coRunIdx; // last used run, pixels are mostly accessed sequentially
+
+    void compileColorOrderRuns();
+    [[gnu::hot]] uint8_t getColorOrderAt(unsigned pix) const; // pix includes skipped pixels
 
     static uint16_t _milliAmpsTotal; // is overwitten/recalculated on each show()
 
@@ -359,12 +384,17 @@ class BusNetwork : public Bus {
     [[gnu::hot]] void setPixelColor(unsigned pix, uint32_t c) override;
     [[gnu::hot]] uint32_t getPixelColor(unsigned pix) const override;
     size_t getPins(uint8_t* pinArray = nullptr) const override;
-    size_t getBusSize() const override  { return sizeof(BusNetwork) + (isOk() ? _len * _UDPchannels : 0); }
+    size_t getBusSize() const override  { return sizeof(BusNetwork) + (isOk() ? _len * _UDPchannels : 0) * (1 + NET_QUEUE_LEN + (_reference != nullptr)) + _e131Universes; }
+    uint16_t getFrequency() const override { return _e131Universes ? _e131Universe : 0; } // E1.31: configured start universe (0 = global default)
+    uint16_t getTransmitTime() const override { return _sendLatency; } // time from show() until frame was sent (us)
     void   show() override;
     void   cleanup();
     #ifdef ARDUINO_ARCH_ESP32
     void   resolveHostname();
     const String getCustomText() const override { return _hostname; }
+    void   sendQueued(); // called from network sender task, sends newest queued frame
+    static inline uint32_t getDroppedFrames()   { return _framesDropped; }
+    static inline uint8_t  getMaxQueueDepth()   { return _maxQueueDepth; }
     #endif
 
     static std::vector<LEDType> getLEDTypes();
@@ -374,9 +404,30 @@ class BusNetwork : public Bus {
     uint8_t   _UDPtype;
     uint8_t   _UDPchannels;
     bool      _broadcastLock;
+    bool      _keyframe;       // next delta stream frame must be a keyframe
     uint8_t   *_data;
+    uint8_t   *_reference;     // delta stream: frame as known by receivers (nullptr for other protocols)
+    uint16_t  _streamSeq;
+    uint16_t  _sendLatency;
+    uint16_t  _e131Universe;   // E1.31: start universe as configured (0 = use e131OutUniverse)
+    uint8_t   _e131Universes;  // E1.31: number of universes sent (size of _e131Seq)
+    uint8_t   *_e131Seq;       // E1.31: per universe sequence numbers of this bus
+
+    void broadcast(const uint8_t *data, uint8_t bri);
     #ifdef ARDUINO_ARCH_ESP32
     String    _hostname;
+    // frames are copied into a single producer/single consumer ring and sent by a separate task so that
+    // WiFi latency does not add to the frame time of local outputs (ring holds NET_QUEUE_LEN-1 frames)
+    static constexpr unsigned NET_QUEUE_LEN = 3;
+    uint8_t   *_queue;                   // NET_QUEUE_LEN frame copies, nullptr if frames are sent synchronously
+    uint8_t   _queueBri[NET_QUEUE_LEN];  // brightness at the time frame was queued
+    uint32_t  _queueTime[NET_QUEUE_LEN]; // micros() when frame was queued
+    volatile uint8_t _queueHead;         // written by show() only
+    volatile uint8_t _queueTail;         // written by sender task only
+    static std::atomic<uint32_t> _framesDropped; // frames skipped because sender could not keep up (counted by show() and sender task)
+    static uint8_t  _maxQueueDepth;
+    #else
+    static constexpr unsigned NET_QUEUE_LEN = 0;
     #endif
 };
 
@@ -561,6 +612,7 @@ namespace BusManager {
 
   [[gnu::hot]] void     setPixelColor(unsigned pix, uint32_t c);
   [[gnu::hot]] uint32_t getPixelColor(unsigned pix);
+  bool        setPixelColors(const uint32_t *c, size_t len, bool gamma); // bulk write of all pixels if there is a single bus supporting it
   void        show();
   bool        canAllShow();
   inline void setStatusPixel(uint32_t c) { for (auto &bus : busses) bus->setStatusPixel(c);}
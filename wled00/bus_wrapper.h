@@ -393,6 +393,13 @@ class PolyBus {
     tm1914_strip->SetPixelSettings(NeoTm1914Settings());  //NeoTm1914_Mode_DinFdinAutoSwitch, NeoTm1914_Mode_DinOnly, NeoTm1914_Mode_FdinOnly 
   }
 
+  template <class T>
+  static uint8_t* rawPixels(void* busPtr) {
+    T strip = static_cast<T>(busPtr);
+    strip->Dirty(); // caller is going to modify the buffer
+    return strip->Pixels();
+  }
+
   static void begin(void* busPtr, uint8_t busType, uint8_t* pins, uint16_t clock_kHz /* only used by DotStar */) {
     switch (busType) {
       case I_NONE: break;
@@ -1024,6 +1031,40 @@ class PolyBus {
     return 0;
   }
 
+  // returns NeoPixelBus pixel buffer for 8 bit GRB/GRBW buses (3 or 4 bytes per pixel in G,R,B,(W) order) or nullptr for any other type
+  // used to bypass per-pixel setPixelColor() calls, buffer is marked dirty
+  static uint8_t* getPixelBuffer(void* busPtr, uint8_t busType) {
+    if (busPtr == nullptr) return nullptr;
+    switch (busType) {
+    #ifdef ESP8266
+      case I_8266_U0_NEO_3: return rawPixels<B_8266_U0_NEO_3*>(busPtr);
+      case I_8266_U1_NEO_3: return rawPixels<B_8266_U1_NEO_3*>(busPtr);
+      case I_8266_DM_NEO_3: return rawPixels<B_8266_DM_NEO_3*>(busPtr);
+      case I_8266_BB_NEO_3: return rawPixels<B_8266_BB_NEO_3*>(busPtr);
+      case I_8266_U0_NEO_4: return rawPixels<B_8266_U0_NEO_4*>(busPtr);
+      case I_8266_U1_NEO_4: return rawPixels<B_8266_U1_NEO_4*>(busPtr);
+      case I_8266_DM_NEO_4: return rawPixels<B_8266_DM_NEO_4*>(busPtr);
+      case I_8266_BB_NEO_4: return rawPixels<B_8266_BB_NEO_4*>(busPtr);
+      case I_8266_U0_400_3: return rawPixels<B_8266_U0_400_3*>(busPtr);
+      case I_8266_U1_400_3: return rawPixels<B_8266_U1_400_3*>(busPtr);
+      case I_8266_DM_400_3: return rawPixels<B_8266_DM_400_3*>(busPtr);
+      case I_8266_BB_400_3: return rawPixels<B_8266_BB_400_3*>(busPtr);
+    #endif
+    #ifdef ARDUINO_ARCH_ESP32
+      case I_32_RN_NEO_3: return rawPixels<B_32_RN_NEO_3*>(busPtr);
+      case I_32_RN_NEO_4: return rawPixels<B_32_RN_NEO_4*>(busPtr);
+      case I_32_RN_400_3: return rawPixels<B_32_RN_400_3*>(busPtr);
+      #if defined(WLED_HAS_PARALLEL_I2S)
+      case I_32_I2_NEO_3: return (_useParallelI2S) ? rawPixels<B_32_IP_NEO_3*>(busPtr) : rawPixels<B_32_I2_NEO_3*>(busPtr);
+      case I_32_I2_NEO_4: return (_useParallelI2S) ? rawPixels<B_32_IP_NEO_4*>(busPtr) : rawPixels<B_32_I2_NEO_4*>(busPtr);
+      case I_32_I2_400_3: return (_useParallelI2S) ? rawPixels<B_32_IP_400_3*>(busPtr) : rawPixels<B_32_I2_400_3*>(busPtr);
+      #endif
+    #endif
+      default: break;
+    }
+    return nullptr;
+  }
+
   static void cleanup(void* busPtr, uint8_t busType) {
     if (busPtr == nullptr) return;
     switch (busType) {
@@ -188,6 +188,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   Bus::setCCTBlend(cctBlending);
   unsigned targetFPS = hw_led["fps"] | WLED_FPS;
   strip.setTargetFps(targetFPS); //unlimited if 0, default 42 FPS
+  CJSON(psFrameBudget, hw_led[F("psb")]);
 
   #ifndef WLED_DISABLE_2D
   // 2D Matrix Settings
@@ -579,6 +580,12 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   CJSON(receiveGroups, if_sync_recv["grp"]);
   CJSON(receiveSegmentOptions, if_sync_recv["seg"]);
   CJSON(receiveSegmentBounds, if_sync_recv["sb"]);
+  CJSON(clockSyncEnabled, if_sync_recv[F("clk")]);
+  CJSON(clockSyncFrames, if_sync_recv[F("clkfr")]);
+  CJSON(fxDeterministic, if_sync_recv[F("det")]);
+  CJSON(canvasLength, if_sync_recv[F("cvlen")]);
+  CJSON(canvasOffset, if_sync_recv[F("cvofs")]);
+  if (canvasLength > MAX_LEDS) canvasLength = 0;
 
   JsonObject if_sync_send = if_sync[F("send")];
   CJSON(sendNotifications, if_sync_send["en"]);
@@ -590,6 +597,11 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   CJSON(syncGroups, if_sync_send["grp"]);
   if (if_sync_send[F("twice")]) udpNumRetries = 1; // import setting from 0.13 and earlier
   CJSON(udpNumRetries, if_sync_send["ret"]);
+  CJSON(notifyDelta, if_sync_send[F("delta")]);
+
+  JsonObject if_ws = interfaces["ws"];
+  CJSON(interfaceUpdateCooldown, if_ws[F("int")]);
+  if (interfaceUpdateCooldown < 100) interfaceUpdateCooldown = 100;
 
   JsonObject if_nodes = interfaces["nodes"];
   CJSON(nodeListEnabled, if_nodes[F("list")]);
@@ -612,8 +624,17 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   if (DMXSegmentSpacing > 150) DMXSegmentSpacing = 0;
   CJSON(e131Priority, if_live_dmx[F("e131prio")]);
   if (e131Priority > 200) e131Priority = 200;
+  CJSON(e131MergeMode, if_live_dmx[F("merge")]);
+  if (e131MergeMode > E131_MERGE_LTP) e131MergeMode = E131_MERGE_NONE;
   CJSON(DMXMode, if_live_dmx["mode"]);
 
+  JsonObject if_live_out = if_live[F("e131out")];
+  CJSON(e131OutUniverse, if_live_out[F("uni")]);
+  CJSON(e131OutPriority, if_live_out[F("prio")]);
+  if (e131OutPriority > 200) e131OutPriority = 200;
+  CJSON(e131OutMulticast, if_live_out[F("mc")]);
+  CJSON(e131OutSyncUniverse, if_live_out[F("sync")]);
+
   tdd = if_live[F("timeout")] | -1;
   if (tdd >= 0) realtimeTimeoutMs = tdd * 100;
 
@@ -627,6 +648,11 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   CJSON(arlsForceMaxBri, if_live[F("maxbri")]);
   CJSON(arlsDisableGammaCorrection, if_live[F("no-gc")]); // false
   CJSON(arlsOffset, if_live[F("offset")]); // 0
+  CJSON(realtimePlayoutFrames, if_live[F("jbuf")]); // 0
+  CJSON(realtimeCanvasWidth, if_live[F("cw")]);   // 0
+  CJSON(realtimeCanvasHeight, if_live[F("ch")]);  // 0
+  CJSON(realtimeCanvasBilinear, if_live[F("cbl")]); // true
+  if (realtimePlayoutFrames > 3) realtimePlayoutFrames = 3;
 
 #ifndef WLED_DISABLE_ALEXA
   CJSON(alexaEnabled, interfaces["va"][F("alexa")]); // false
@@ -965,6 +991,7 @@ void serializeConfig(JsonObject root) {
   hw_led[F("ic")] = cctICused;
   hw_led[F("cb")] = Bus::getCCTBlend();
   hw_led["fps"] = strip.getTargetFps();
+  hw_led[F("psb")] = psFrameBudget;
   hw_led[F("rgbwm")] = Bus::getGlobalAWMode(); // global auto white mode override
 
   #ifndef WLED_DISABLE_2D
@@ -1125,6 +1152,11 @@ void serializeConfig(JsonObject root) {
   if_sync_recv["grp"] = receiveGroups;
   if_sync_recv["seg"] = receiveSegmentOptions;
   if_sync_recv["sb"]  = receiveSegmentBounds;
+  if_sync_recv[F("clk")]   = clockSyncEnabled;
+  if_sync_recv[F("clkfr")] = clockSyncFrames;
+  if_sync_recv[F("det")]   = fxDeterministic;
+  if_sync_recv[F("cvlen")] = canvasLength;
+  if_sync_recv[F("cvofs")] = canvasOffset;
 
   JsonObject if_sync_send = if_sync.createNestedObject(F("send"));
   if_sync_send["en"] = sendNotifications;
@@ -1134,6 +1166,10 @@ void serializeConfig(JsonObject root) {
   if_sync_send["hue"] = notifyHue;
   if_sync_send["grp"] = syncGroups;
   if_sync_send["ret"] = udpNumRetries;
+  if_sync_send[F("delta")] = notifyDelta;
+
+  JsonObject if_ws = interfaces.createNestedObject("ws");
+  if_ws[F("int")] = interfaceUpdateCooldown;
 
   JsonObject if_nodes = interfaces.createNestedObject("nodes");
   if_nodes[F("list")] = nodeListEnabled;
@@ -1150,9 +1186,16 @@ void serializeConfig(JsonObject root) {
   if_live_dmx[F("uni")] = e131Universe;
   if_live_dmx[F("seqskip")] = e131SkipOutOfSequence;
   if_live_dmx[F("e131prio")] = e131Priority;
+  if_live_dmx[F("merge")] = e131MergeMode;
   if_live_dmx[F("addr")] = DMXAddress;
   if_live_dmx[F("dss")] = DMXSegmentSpacing;
   if_live_dmx["mode"] = DMXMode;
+
+  JsonObject if_live_out = if_live.createNestedObject(F("e131out"));
+  if_live_out[F("uni")] = e131OutUniverse;
+  if_live_out[F("prio")] = e131OutPriority;
+  if_live_out[F("mc")] = e131OutMulticast;
+  if_live_out[F("sync")] = e131OutSyncUniverse;
   #ifdef WLED_ENABLE_DMX_INPUT
     if_live_dmx[F("inputRxPin")] = dmxInputTransmitPin;
     if_live_dmx[F("inputTxPin")] = dmxInputReceivePin;
@@ -1164,6 +1207,10 @@ void serializeConfig(JsonObject root) {
   if_live[F("maxbri")] = arlsForceMaxBri;
   if_live[F("no-gc")] = arlsDisableGammaCorrection;
   if_live[F("offset")] = arlsOffset;
+  if_live[F("jbuf")] = realtimePlayoutFrames;
+  if_live[F("cw")] = realtimeCanvasWidth;
+  if_live[F("ch")] = realtimeCanvasHeight;
+  if_live[F("cbl")] = realtimeCanvasBilinear;
 
 #ifndef WLED_DISABLE_ALEXA
   JsonObject if_va = interfaces.createNestedObject("va");
@@ -153,72 +153,73 @@ void setRandomColor(byte* rgb)
 /*
  * generates a random palette based on harmonic color theory
  * takes a base palette as the input, it will choose one color of the base palette and keep it
+ * random numbers come from fx_random8() so palettes can be generated deterministically (see handleRandomPalette())
  */
 CRGBPalette16 generateHarmonicRandomPalette(const CRGBPalette16 &basepalette)
 {
   CHSV palettecolors[4]; // array of colors for the new palette
-  uint8_t keepcolorposition = hw_random8(4); // color position of current random palette to keep
+  uint8_t keepcolorposition = fx_random8(4); // color position of current random palette to keep
   palettecolors[keepcolorposition] = rgb2hsv(basepalette.entries[keepcolorposition*5]); // read one of the base colors of the current palette
-  palettecolors[keepcolorposition].hue += hw_random8(10)-5; // +/- 5 randomness of base color
+  palettecolors[keepcolorposition].hue += fx_random8(10)-5; // +/- 5 randomness of base color
   // generate 4 saturation and brightness value numbers
   // only one saturation is allowed to be below 200 creating mostly vibrant colors
   // only one brightness value number is allowed below 200, creating mostly bright palettes
 
   for (int i = 0; i < 3; i++) { // generate three high values
-    palettecolors[i].saturation = hw_random8(200,255);
-    palettecolors[i].value = hw_random8(220,255);
+    palettecolors[i].saturation = fx_random8(200,255);
+    palettecolors[i].value = fx_random8(220,255);
   }
   // allow one to be lower
-  palettecolors[3].saturation = hw_random8(20,255);
-  palettecolors[3].value = hw_random8(80,255);
+  palettecolors[3].saturation = fx_random8(20,255);
+  palettecolors[3].value = fx_random8(80,255);
 
   // shuffle the arrays
   for (int i = 3; i > 0; i--) {
-    std::swap(palettecolors[i].saturation, palettecolors[hw_random8(i + 1)].saturation);
-    std::swap(palettecolors[i].value, palettecolors[hw_random8(i + 1)].value);
+    std::swap(palettecolors[i].saturation, palettecolors[fx_random8(i + 1)].saturation);
+    std::swap(palettecolors[i].value, palettecolors[fx_random8(i + 1)].value);
   }
 
   // now generate three new hues based off of the hue of the chosen current color
   uint8_t basehue = palettecolors[keepcolorposition].hue;
   uint8_t harmonics[3]; // hues that are harmonic but still a little random
-  uint8_t type = hw_random8(5); // choose a harmony type
+  uint8_t type = fx_random8(5); // choose a harmony type
 
   switch (type) {
     case 0: // analogous
-      harmonics[0] = basehue + hw_random8(30, 50);
-      harmonics[1] = basehue + hw_random8(10, 30);
-      harmonics[2] = basehue - hw_random8(10, 30);
+      harmonics[0] = basehue + fx_random8(30, 50);
+      harmonics[1] = basehue + fx_random8(10, 30);
+      harmonics[2] = basehue - fx_random8(10, 30);
       break;
 
     case 1: // triadic
-      harmonics[0] = basehue + 113 + hw_random8(15);
-      harmonics[1] = basehue + 233 + hw_random8(15);
-      harmonics[2] = basehue -   7 + hw_random8(15);
+      harmonics[0] = basehue + 113 + fx_random8(15);
+      harmonics[1] = basehue + 233 + fx_random8(15);
+      harmonics[2] = basehue -   7 + fx_random8(15);
       break;
 
     case 2: // split-complementary
-      harmonics[0] = basehue + 145 + hw_random8(10);
-      harmonics[1] = basehue + 205 + hw_random8(10);
-      harmonics[2] = basehue -   5 + hw_random8(10);
+      harmonics[0] = basehue + 145 + fx_random8(10);
+      harmonics[1] = basehue + 205 + fx_random8(10);
+      harmonics[2] = basehue -   5 + fx_random8(10);
       break;
 
     case 3: // square
-      harmonics[0] = basehue +  85 + hw_random8(10);
-      harmonics[1] = basehue + 175 + hw_random8(10);
-      harmonics[2] = basehue + 265 + hw_random8(10);
+      harmonics[0] = basehue +  85 + fx_random8(10);
+      harmonics[1] = basehue + 175 + fx_random8(10);
+      harmonics[2] = basehue + 265 + fx_random8(10);
      break;
 
     case 4: // tetradic
-      harmonics[0] = basehue +  80 + hw_random8(20);
-      harmonics[1] = basehue + 170 + hw_random8(20);
-      harmonics[2] = basehue -  15 + hw_random8(30);
+      harmonics[0] = basehue +  80 + fx_random8(20);
+      harmonics[1] = basehue + 170 + fx_random8(20);
+      harmonics[2] = basehue -  15 + fx_random8(30);
      break;
   }
 
-  if (hw_random8() < 128) {
+  if (fx_random8() < 128) {
     // 50:50 chance of shuffling hues or keep the color order
     for (int i = 2; i > 0; i--) {
-      std::swap(harmonics[i], harmonics[hw_random8(i + 1)]);
+      std::swap(harmonics[i], harmonics[fx_random8(i + 1)]);
     }
   }
 
@@ -231,7 +232,7 @@ CRGBPalette16 generateHarmonicRandomPalette(const CRGBPalette16 &basepalette)
   }
 
   bool makepastelpalette = false;
-  if (hw_random8() < 25) { // ~10% chance of desaturated 'pastel' colors
+  if (fx_random8() < 25) { // ~10% chance of desaturated 'pastel' colors
     makepastelpalette = true;
   }
 
@@ -253,10 +254,10 @@ CRGBPalette16 generateHarmonicRandomPalette(const CRGBPalette16 &basepalette)
 
 CRGBPalette16 generateRandomPalette()  // generate fully random palette
 {
-  return CRGBPalette16(CHSV(hw_random8(), hw_random8(160, 255), hw_random8(128, 255)),
-                       CHSV(hw_random8(), hw_random8(160, 255), hw_random8(128, 255)),
-                       CHSV(hw_random8(), hw_random8(160, 255), hw_random8(128, 255)),
-                       CHSV(hw_random8(), hw_random8(160, 255), hw_random8(128, 255)));
+  return CRGBPalette16(CHSV(fx_random8(), fx_random8(160, 255), fx_random8(128, 255)),
+                       CHSV(fx_random8(), fx_random8(160, 255), fx_random8(128, 255)),
+                       CHSV(fx_random8(), fx_random8(160, 255), fx_random8(128, 255)),
+                       CHSV(fx_random8(), fx_random8(160, 255), fx_random8(128, 255)));
 }
 
 void loadCustomPalettes() {
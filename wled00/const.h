@@ -304,6 +304,32 @@ static_assert(WLED_MAX_BUSSES <= 32, "WLED_MAX_BUSSES exceeds hard limit");
 #define REALTIME_MODE_TPM2NET     7
 #define REALTIME_MODE_DDP         8
 #define REALTIME_MODE_DMX         9
+#define REALTIME_MODE_WLED        10
+
+//WLED delta stream (network bus output, realtime input on DDP port)
+//header: "WLDS", flags, chunk index, frame sequence (2), channel offset (4), payload length (2)
+#define WLED_STREAM_HEADER_LEN    14
+#define WLED_STREAM_KEYFRAME      0x00         //payload: raw channel data
+#define WLED_STREAM_DELTA         0x01         //payload: run-length encoded XOR against previous frame
+#define WLED_STREAM_REQUEST       0x02         //receiver asks sender for a keyframe (no payload)
+#define WLED_STREAM_KIND_MASK     0x03
+#define WLED_STREAM_RGBW          0x10
+#define WLED_STREAM_LAST          0x80         //last chunk of frame, show
+#define WLED_STREAM_KEY_INTERVAL  120          //frames between periodic keyframes (receivers joining late)
+
+//effect clock sync on notifier port, timestamps are 64 bit big endian microseconds
+//request: 0xFE, 1, t1 (client send)  response: 0xFE, 2, t1, t2 (master receive), t3 (master send)
+#define CLOCK_SYNC_PACKET         0xFE
+#define CLOCK_SYNC_REQUEST        1
+#define CLOCK_SYNC_RESPONSE       2
+#define CLOCK_SYNC_REQ_LEN        10
+#define CLOCK_SYNC_RESP_LEN       26
+
+//WLED notifier v13: full packets carry a trailing sequence number, receivers acknowledge them,
+//further packets carry only bytes changed against the acknowledged one (callMode byte > 199 is ignored by older receivers)
+//delta: 0, NOTIFIER_DELTA, sequence, base sequence, packet length (2), runs of: offset (2), length, changed bytes
+#define NOTIFIER_DELTA            200
+#define NOTIFIER_ACK              201          //0, NOTIFIER_ACK, sequence
 
 //realtime override modes
 #define REALTIME_OVERRIDE_NONE    0
@@ -323,6 +349,11 @@ static_assert(WLED_MAX_BUSSES <= 32, "WLED_MAX_BUSSES exceeds hard limit");
 #define DMX_MODE_EFFECT_SEGMENT_W 9            //trigger standalone effects of WLED (18 channels per segment)
 #define DMX_MODE_PRESET           10           //apply presets (1 channel)
 
+//E1.31 / Art-Net multi-source merge
+#define E131_MERGE_NONE           0            //no source tracking, last packet wins
+#define E131_MERGE_HTP            1            //highest value of all top priority sources per channel
+#define E131_MERGE_LTP            2            //latest change of all top priority sources per channel
+
 //Light capability byte (unused) 0bRCCCTTTT
 //bits 0/1/2/3: specifies a type of LED driver. A single "driver" may have different chip models but must have the same protocol/behavior
 //bits 4/5/6: specifies the class of LED driver - 0b000 (dec. 0-15)  unconfigured/reserved
@@ -384,10 +415,12 @@ static_assert(WLED_MAX_BUSSES <= 32, "WLED_MAX_BUSSES exceeds hard limit");
 //Network types (master broadcast) (80-95)
 #define TYPE_VIRTUAL_MIN         80
 #define TYPE_NET_DDP_RGB         80            //network DDP RGB bus (master broadcast bus)
-#define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus, unused)
+#define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus)
 #define TYPE_NET_ARTNET_RGB      82            //network ArtNet RGB bus (master broadcast bus, unused)
+#define TYPE_NET_WLED_RGB        83            //network WLED delta stream RGB bus (master broadcast bus)
 #define TYPE_NET_DDP_RGBW        88            //network DDP RGBW bus (master broadcast bus)
 #define TYPE_NET_ARTNET_RGBW     89            //network ArtNet RGB bus (master broadcast bus, unused)
+#define TYPE_NET_WLED_RGBW       90            //network WLED delta stream RGBW bus (master broadcast bus)
 #define TYPE_VIRTUAL_MAX         95
 
 //Color orders
@@ -531,6 +564,7 @@ static_assert(WLED_MAX_BUSSES <= 32, "WLED_MAX_BUSSES exceeds hard limit");
 #define JSON_LOCK_LEDMAP_ENUM     21
 #define JSON_LOCK_REMOTE          22
 #define JSON_LOCK_OTA             23
+#define JSON_LOCK_PRESET_PREFETCH 24
 
 // Timer mode types
 #define NL_MODE_SET               0            //After nightlight time elapsed, set to target brightness
@@ -208,6 +208,27 @@ function connectWs(onOpen) {
 	return ws;
 }
 
+// decode live view packet v3 ('L', 3, flags, width, height, key frame RGB or delta runs, see ws.cpp)
+// f: {w,h,rgb} holding the previous frame, updated in place; returns false if f could not be updated
+function decodeLive(data, f) {
+	let p = new Uint8Array(data);
+	if (p[0] != 76 || p[1] != 3) return false; // 'L'
+	let w = (p[3]<<8) | p[4], h = (p[5]<<8) | p[6];
+	if (p[2] & 1) { // key frame
+		f.w = w; f.h = h; f.rgb = p.slice(7, 7 + w*h*3);
+		return true;
+	}
+	if (!f.rgb || f.w != w || f.h != h) return false; // delta without base frame
+	for (let i = 7, x = 0; i + 3 <= p.length;) {
+		x += ((p[i]<<8) | p[i+1]) * 3; // skip unchanged pixels
+		let n = p[i+2] * 3;
+		i += 3;
+		f.rgb.set(p.subarray(i, i + n), x);
+		x += n; i += n;
+	}
+	return true;
+}
+
 // send LED colors to ESP using WebSocket and DDP protocol (RGB)
 // ws: WebSocket object
 // start: start pixel index
@@ -27,6 +27,7 @@ var lastinfo = {};
 var isM = false, mw = 0, mh=0;
 var bsOpts = null; // blending style options snapshot, used for dynamic filtering based on matrix mode (iOS compatibility)
 var ws, wsRpt=0;
+var wsState = null, wsVer = -1; // last state pushed via WS (base for patches) and its version
 var _selFxInterval = null; // interval ID for selected effect position update
 var cfg = {
 	theme:{base:"dark", bg:{url:"", rnd: false, rndGrayscale: false, rndBlur: false}, alpha:{bg:0.6,tab:0.8}, color:{bg:""}},
@@ -1435,6 +1436,26 @@ function makeWS() {
 		if (e.data instanceof ArrayBuffer) return; // liveview packet
 		var json = JSON.parse(e.data);
 		if (json.leds) return; // JSON liveview packet
+		if (json.p) { // patch: only values changed since push json.p.b
+			if (!wsState || json.p.b !== wsVer) { ws.send('{"v":true}'); return; } // missed a push, request full state
+			wsVer = json.p.v;
+			let s = json.state;
+			if (s) {
+				if (s.seg && !json.p.sa) { // merge changed segments by id
+					for (let sg of s.seg) {
+						let x = wsState.seg.findIndex((o)=>o.id===sg.id);
+						if (x < 0) wsState.seg.push(sg); else wsState.seg[x] = sg;
+					}
+					delete s.seg;
+				}
+				Object.assign(wsState, s);
+			}
+			if (json.info) json.info = Object.assign({}, lastinfo, json.info);
+			json.state = wsState;
+		} else if (json.state && json.pv !== undefined) {
+			wsState = json.state;
+			wsVer = json.pv;
+		}
 		clearTimeout(jsonTimeout);
 		jsonTimeout = null;
 		lastUpdate = new Date();
@@ -1458,6 +1479,7 @@ function makeWS() {
 	}
 	ws.onopen = (e)=>{
 		//ws.send("{'v':true}"); // unnecessary (https://github.com/wled/WLED/blob/master/wled00/ws.cpp#L18)
+		ws.send('{"pt":true}'); // receive patches instead of full state
 		wsRpt = 0;
 		reqsLegal = true;
 	}
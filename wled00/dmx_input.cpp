@@ -264,7 +264,7 @@ void DMXInput::update()
   }
   else if (connected) {
     const std::lock_guard<std::mutex> lock(dmxDataLock);
-    handleDMXData(1, 512, dmxdata, REALTIME_MODE_DMX, 0);
+    if (handleDMXData(1, 512, dmxdata, REALTIME_MODE_DMX, 0)) e131NewData = true;
   }
 }
 
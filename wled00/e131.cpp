@@ -4,8 +4,29 @@
 #define MAX_4_CH_LEDS_PER_UNIVERSE 128
 #define MAX_CHANNELS_PER_UNIVERSE 512
 
+#define E131_FRAME_TIMEOUT 50         // ms, show incomplete frame if missing universes did not arrive in time
+#define ARTNET_SYNC_TIMEOUT 4000      // ms, Art-Net sync mode ends if no ArtSync is received (Art-Net 4 spec)
+#define E131_MAX_SOURCES 3            // sources tracked per universe for merging
+#define E131_SOURCE_TIMEOUT 2500      // ms, source is considered lost (E1.31 network data loss timeout)
+#define PLAYOUT_MAX_FRAMES 3          // max. depth of realtime playout (jitter) buffer
+#define PLAYOUT_MAX_GAP 1000          // ms, longer gaps between frames are treated as stream restart
+
+// receive state below is written by the UDP (AsyncUDP) and WebSocket tasks and by the main loop
+#ifdef ARDUINO_ARCH_ESP32
+static SemaphoreHandle_t e131RxMutex = xSemaphoreCreateMutex();
+static inline void lockE131Rx()   { xSemaphoreTake(e131RxMutex, portMAX_DELAY); }
+static inline void unlockE131Rx() { xSemaphoreGive(e131RxMutex); }
+#else
+static inline void lockE131Rx()   {}
+static inline void unlockE131Rx() {}
+#endif
+
 // forward declarations
+static bool playoutWrite(unsigned start, const uint8_t *data, unsigned count, unsigned channels);
+static void playoutPush(bool buffered, bool hasTimecode, uint32_t timecode);
+static void freeE131Sources();
 static void handleDDPPacket(e131_packet_t* p, size_t packetLen);
+static void handleStreamPacket(const uint8_t *pkt, size_t packetLen, IPAddress clientIP);
 static void handleArtnetPollReply(IPAddress ipAddress);
 static void prepareArtnetPollReply(ArtPollReply *reply);
 static void sendArtnetPollReply(ArtPollReply *reply, IPAddress ipAddress, uint16_t portAddress);
@@ -60,7 +81,8 @@ static void handleDDPPacket(e131_packet_t* p, size_t packetLen) {
   unsigned stop = start + dataLen / ddpChannelsPerLed;
   uint8_t* data = p->data;
   unsigned c = 0;
-  if (p->flags & DDP_FLAGS_TIME) c = 4; //packet has timecode flag, we do not support it, but data starts 4 bytes later
+  bool hasTimecode = p->flags & DDP_FLAGS_TIME;
+  if (hasTimecode) c = 4; //packet has timecode, data starts 4 bytes later
 
   // ensure the received packet is at least as long as the header claims
   if (packetLen < DDP_HEADER_LEN + c + dataLen) {
@@ -78,22 +100,452 @@ static void handleDDPPacket(e131_packet_t* p, size_t packetLen) {
   if (realtimeMode != REALTIME_MODE_DDP) ddpSeenPush = false; // just starting, no push yet
   realtimeLock(realtimeTimeoutMs, REALTIME_MODE_DDP);
 
+  bool buffered = false;
   if (!realtimeOverride) {
-    for (unsigned i = start; i < stop; i++, c += ddpChannelsPerLed) {
-      setRealtimePixel(i, data[c], data[c+1], data[c+2], ddpChannelsPerLed >3 ? data[c+3] : 0);
-    }
+    buffered = playoutWrite(start, data + c, numLeds, ddpChannelsPerLed);
+    if (!buffered) setRealtimePixels(start, data + c, numLeds, ddpChannelsPerLed);
   }
 
   ddpSeenPush |= push;
   if (!ddpSeenPush || push) { // if we've never seen a push, or this is one, render display
-    e131NewData = true;
+    uint32_t timecode = hasTimecode ? (uint32_t)data[0]<<24 | (uint32_t)data[1]<<16 | (uint32_t)data[2]<<8 | data[3] : 0;
+    playoutPush(buffered, hasTimecode, timecode);
     int sn = p->sequenceNum & 0xF;
     if (sn) e131LastSequenceNumber[0] = sn;
   }
 }
 
+/*
+ * Realtime playout (jitter) buffer: received DDP frames are held for realtimePlayoutFrames frame intervals
+ * and shown at a steady pace instead of as soon as they arrive, which smooths out Wi-Fi arrival jitter.
+ * Frames are scheduled by the sender timecode (DDP_FLAGS_TIME) if present, else by a smoothed arrival clock.
+ * Slot playoutRecv receives packet data, up to realtimePlayoutFrames completed slots wait for playout.
+ */
+static uint8_t      *playoutBuf      = nullptr;  // (PLAYOUT_MAX_FRAMES+1) frame slots
+static size_t        playoutSlotLen  = 0;        // bytes per slot
+static uint8_t       playoutChannels = 0;        // channels per LED stored in slots
+static uint8_t       playoutHead     = 0;        // oldest queued slot
+static uint8_t       playoutCount    = 0;        // number of queued slots
+static uint8_t       playoutRecv     = 0;        // slot currently receiving data
+static unsigned long playoutDue[PLAYOUT_MAX_FRAMES+1];
+static unsigned long playoutLastDue  = 0;        // show time of last queued frame (0 = not synced)
+static unsigned long lastFrameArrival = 0;       // millis() of last pushed frame
+static uint32_t      lastTimecode    = 0;
+static uint32_t      frameInterval16 = 0;        // smoothed frame interval (ms * 16)
+static uint32_t      frameJitter16   = 0;        // smoothed interarrival jitter (ms * 16, RFC 3550)
+
+static void playoutFree() {
+  p_free(playoutBuf);
+  playoutBuf = nullptr;
+  playoutSlotLen = 0;
+  playoutCount = 0;
+  playoutLastDue = 0;
+}
+
+static inline uint8_t *playoutSlot(unsigned i) { return playoutBuf + i * playoutSlotLen; }
+
+// stores received data in the frame being assembled, returns false if data must be applied directly
+static bool playoutWrite(unsigned start, const uint8_t *data, unsigned count, unsigned channels) {
+  if (!realtimePlayoutFrames) {
+    if (playoutBuf) playoutFree();
+    return false;
+  }
+  size_t slotLen = strip.getLengthTotal() * channels;
+  if (!playoutBuf || slotLen != playoutSlotLen) {
+    playoutFree();
+    playoutBuf = static_cast<uint8_t*>(p_malloc((PLAYOUT_MAX_FRAMES+1) * slotLen));
+    if (!playoutBuf) {
+      DEBUG_PRINTLN(F("Playout buffer allocation failed."));
+      return false;
+    }
+    memset(playoutBuf, 0, (PLAYOUT_MAX_FRAMES+1) * slotLen);
+    playoutSlotLen  = slotLen;
+    playoutChannels = channels;
+    playoutHead = playoutRecv = 0;
+  }
+  unsigned len = strip.getLengthTotal();
+  if (start >= len) return true;
+  if (count > len - start) count = len - start;
+  memcpy(playoutSlot(playoutRecv) + start * channels, data, count * channels);
+  return true;
+}
+
+// completes a frame: updates arrival statistics and schedules the frame for playout (if buffered)
+static void playoutPush(bool buffered, bool hasTimecode, uint32_t timecode) {
+  unsigned long now = millis();
+  uint32_t interval = now - lastFrameArrival;
+  uint32_t senderInterval = interval;
+  if (hasTimecode) senderInterval = ((uint64_t)(timecode - lastTimecode) * 1000) >> 16; // 16.16 seconds
+  bool restart = !lastFrameArrival || interval > PLAYOUT_MAX_GAP || senderInterval > PLAYOUT_MAX_GAP;
+  lastFrameArrival = now;
+  lastTimecode = timecode;
+
+  if (!restart) {
+    if (!frameInterval16) frameInterval16 = interval << 4;
+    else frameInterval16 += (int32_t)((interval << 4) - frameInterval16) / 8;
+    int32_t d = (int32_t)(senderInterval << 4) - (int32_t)(hasTimecode ? interval << 4 : frameInterval16);
+    frameJitter16 += ((d < 0 ? -d : d) - (int32_t)frameJitter16) / 16;
+    realtimeJitter = frameJitter16 >> 4;
+  }
+
+  if (!buffered) {
+    e131NewData = true; // show in handleNotifications()
+    return;
+  }
+
+  // schedule frame: steady pace relative to previous frame, re-sync if buffer ran empty or drifted too far ahead
+  unsigned long latency = (realtimePlayoutFrames * frameInterval16) >> 4;
+  unsigned long due = playoutLastDue + (hasTimecode ? senderInterval : frameInterval16 >> 4);
+  if (restart || !playoutLastDue || (long)(due - now) < 0 || due - now > 2 * latency) {
+    if (!restart && playoutLastDue && (long)(due - now) < 0) realtimeFramesLate++;
+    due = now + latency;
+  }
+  playoutLastDue = due;
+
+  if (playoutCount >= realtimePlayoutFrames) { // buffer full, drop oldest frame
+    playoutHead = (playoutHead + 1) % (PLAYOUT_MAX_FRAMES+1);
+    playoutCount--;
+    realtimeFramesDropped++;
+  }
+  playoutDue[playoutRecv] = due;
+  playoutCount++;
+  unsigned next = (playoutRecv + 1) % (PLAYOUT_MAX_FRAMES+1);
+  memcpy(playoutSlot(next), playoutSlot(playoutRecv), playoutSlotLen); // DDP packets may update only part of a frame
+  playoutRecv = next;
+}
+
+// called from handleNotifications(), buffer and queue are shared with the receive task (see handleE131Packet())
+void handleRealtimePlayout() {
+  lockE131Rx();
+  if (!realtimeMode) {
+    if (playoutBuf) playoutFree();
+    lastFrameArrival = 0;
+  } else {
+    if (realtimeOverride) playoutCount = 0;
+    if (playoutCount && (long)(millis() - playoutDue[playoutHead]) >= 0) {
+      setRealtimePixels(0, playoutSlot(playoutHead), playoutSlotLen / playoutChannels, playoutChannels);
+      playoutHead = (playoutHead + 1) % (PLAYOUT_MAX_FRAMES+1);
+      playoutCount--;
+      e131NewData = true;
+    }
+  }
+  unlockE131Rx();
+}
+
+/*
+ * WLED delta stream receiver (see realtimeBroadcastDelta()): chunks are decoded into streamFrame, which must match
+ * the sender's reference frame for deltas to apply. A lost chunk or frame invalidates it until the next keyframe.
+ */
+static uint8_t      *streamFrame       = nullptr; // decoded channel data
+static size_t        streamFrameLen    = 0;
+static uint8_t       streamChannels    = 0;
+static uint16_t      streamSeq         = 0;       // frame being decoded
+static uint8_t       streamChunk       = 0;       // next expected chunk of that frame
+static bool          streamValid       = false;   // all chunks of current frame so far were applied
+static bool          streamSynced      = false;   // streamFrame matches sender after last complete frame
+static unsigned long streamLastRequest = 0;
+
+static void requestStreamKeyframe(IPAddress sender) {
+  if (millis() - streamLastRequest < 100) return; // sender needs a frame to respond
+  streamLastRequest = millis();
+  uint8_t req[WLED_STREAM_HEADER_LEN] = {'W','L','D','S', WLED_STREAM_REQUEST};
+  lockUdpSockets();
+  notifierUdp.beginPacket(sender, DDP_DEFAULT_PORT);
+  notifierUdp.write(req, sizeof(req));
+  notifierUdp.endPacket();
+  unlockUdpSockets();
+}
+
+// applies run-length encoded XOR data to dst (writes beyond len are discarded)
+static void applyStreamDelta(uint8_t *dst, size_t pos, size_t len, const uint8_t *in, size_t inLen) {
+  const uint8_t *inEnd = in + inLen;
+  while (in < inEnd) {
+    const uint8_t ctrl = *in++;
+    const size_t n = (ctrl & 0x7F) + 1;
+    if (ctrl & 0x80) { pos += n; continue; } // unchanged channels
+    for (size_t i = 0; i < n && in < inEnd; i++, pos++, in++) if (pos < len) dst[pos] ^= *in;
+  }
+}
+
+static void handleStreamPacket(const uint8_t *pkt, size_t packetLen, IPAddress clientIP) {
+  const uint8_t flags = pkt[4];
+  const uint8_t kind = flags & WLED_STREAM_KIND_MASK;
+  if (kind == WLED_STREAM_REQUEST) { // we are the sender
+    requestRealtimeKeyframe(clientIP);
+    return;
+  }
+  if (kind > WLED_STREAM_DELTA) return;
+  const uint8_t  chunk      = pkt[5];
+  const uint16_t seq        = (pkt[6] << 8) | pkt[7];
+  const uint32_t offset     = ((uint32_t)pkt[8] << 24) | ((uint32_t)pkt[9] << 16) | (pkt[10] << 8) | pkt[11];
+  const uint16_t payloadLen = (pkt[12] << 8) | pkt[13];
+  if (packetLen < WLED_STREAM_HEADER_LEN + payloadLen) return;
+  const uint8_t *payload = pkt + WLED_STREAM_HEADER_LEN;
+
+  const unsigned channels = flags & WLED_STREAM_RGBW ? 4 : 3;
+  const size_t frameLen = strip.getLengthTotal() * channels;
+  if (!streamFrame || channels != streamChannels || frameLen != streamFrameLen) {
+    p_free(streamFrame);
+    streamFrame = static_cast<uint8_t*>(p_calloc(1, frameLen));
+    streamFrameLen = streamFrame ? frameLen : 0;
+    streamChannels = channels;
+    streamSynced = false;
+    if (!streamFrame) return;
+  }
+
+  if (chunk == 0) {
+    streamValid = kind == WLED_STREAM_KEYFRAME || (streamSynced && seq == uint16_t(streamSeq + 1));
+    streamSeq = seq;
+    streamChunk = 0;
+    streamSynced = false; // until frame is complete
+  } else if (seq != streamSeq || chunk != streamChunk) {
+    streamValid = false;
+  }
+  if (!streamValid) {
+    requestStreamKeyframe(clientIP);
+    return;
+  }
+  streamChunk++;
+
+  if (kind == WLED_STREAM_KEYFRAME) {
+    if (offset < streamFrameLen) memcpy(streamFrame + offset, payload, std::min<size_t>(payloadLen, streamFrameLen - offset));
+  } else {
+    applyStreamDelta(streamFrame, offset, streamFrameLen, payload, payloadLen);
+  }
+  if (!(flags & WLED_STREAM_LAST)) return;
+  streamSynced = true;
+
+  realtimeIP = clientIP;
+  realtimeLock(realtimeTimeoutMs, REALTIME_MODE_WLED);
+  bool buffered = false;
+  if (!realtimeOverride) {
+    const unsigned numLeds = streamFrameLen / channels;
+    buffered = playoutWrite(0, streamFrame, numLeds, channels);
+    if (!buffered) setRealtimePixels(0, streamFrame, numLeds, channels);
+  }
+  playoutPush(buffered, false, 0);
+}
+
+/*
+ * Universe frame assembly: data of all universes belonging to one frame is collected before the frame is shown,
+ * so multi-universe setups do not display partially updated frames. A frame is shown (once) when
+ * - all universes seen in the last two frames have arrived (no sync mode)
+ * - an E1.31 synchronization packet or ArtSync is received (sync mode)
+ * - a universe of the next frame arrives or E131_FRAME_TIMEOUT has passed (incomplete frame)
+ */
+static uint32_t      frameUniverses   = 0; // bitmap of universes received for current frame
+static uint32_t      frameExpected    = 0; // bitmap of universes that made up the last two frames
+static uint32_t      framePrevious    = 0; // bitmap of universes of the last shown frame
+static unsigned long frameStart       = 0; // millis() when first universe of current frame arrived (0 = no frame pending)
+static uint16_t      frameSyncAddress = 0; // E1.31 synchronization universe announced by source (0 = no sync)
+static uint16_t      frameSyncJoined  = 0; // synchronization universe whose multicast group was joined (main loop only)
+static unsigned long lastArtSync      = 0; // millis() of last ArtSync
+static uint8_t       frameSources[E131_MAX_UNIVERSE_COUNT] = {0}; // live merge sources per universe (see mergeSource())
+
+static inline bool frameSyncMode() {
+  return frameSyncAddress || (lastArtSync && millis() - lastArtSync < ARTNET_SYNC_TIMEOUT);
+}
+
+static void finishFrame() {
+  if (!frameStart) return;
+  uint32_t missing = frameExpected & ~frameUniverses;
+  if (missing) e131DroppedUniverses += __builtin_popcount(missing);
+  frameExpected = framePrevious | frameUniverses; // universes missing from two frames in a row are no longer waited for
+  framePrevious = frameUniverses;
+  frameUniverses = 0;
+  frameStart = 0;
+  e131NewData = true; // show in handleNotifications()
+}
+
+// returns false if universe data is late (belongs to a frame that was already shown)
+// sequence numbers are only checked if the user enabled skipping out-of-sequence packets
+static bool frameAcceptUniverse(unsigned idx, int seq) {
+  if (e131SkipOutOfSequence && seq) { // sequence 0 means "not used" (Art-Net)
+    int8_t age = seq - e131LastSequenceNumber[idx];
+    if (age <= 0 && age > -20) { // duplicate or older than last applied data for this universe
+      e131LateUniverses++;
+      return false;
+    }
+  }
+  // universe repeats: previous frame is over (incomplete), unless the repeat is the same universe from another merged source
+  if ((frameUniverses & (1UL << idx)) && frameSources[idx] <= 1) finishFrame();
+  return true;
+}
+
+static void frameAddUniverse(unsigned idx) {
+  if (!frameStart) frameStart = millis() | 1;
+  frameUniverses |= 1UL << idx;
+  if (!frameSyncMode() && frameExpected && (frameUniverses & frameExpected) == frameExpected) finishFrame();
+}
+
+// called from handleNotifications()
+void handleE131FrameTimeout() {
+  lockE131Rx();
+  if (!realtimeMode) { // forget universe layout & sync mode when source stopped sending
+    frameExpected = framePrevious = frameUniverses = 0;
+    frameStart = 0;
+    frameSyncAddress = 0;
+    freeE131Sources();
+    if (streamFrame) { // delta stream receiver reallocates it in handleStreamPacket() under the same lock
+      p_free(streamFrame);
+      streamFrame = nullptr;
+      streamSynced = false;
+    }
+  } else if (frameStart && millis() - frameStart > E131_FRAME_TIMEOUT) finishFrame();
+  const uint16_t syncAddress = frameSyncAddress;
+  unlockE131Rx();
+
+  // multicast: sync packets are sent to the group of the sync universe, which is not among the joined data universes
+  if (syncAddress != frameSyncJoined) {
+    e131.joinMulticastUniverse(frameSyncJoined, false);
+    e131.joinMulticastUniverse(syncAddress);
+    frameSyncJoined = syncAddress;
+  }
+}
+
+/*
+ * Multi-source merge: sources sending to the same universe (identified by E1.31 CID or Art-Net IP) are tracked
+ * with their priority. Only sources at the highest priority are used; if there are several, their data is merged
+ * per channel by highest value (HTP) or by latest change (LTP). A single source is passed through without copying.
+ * Channel data is kept 4-byte aligned (channel 1 at offset 4) so HTP can compare 4 channels at once.
+ */
+#define E131_MERGE_BUFSIZE (4 + MAX_CHANNELS_PER_UNIVERSE)
+
+typedef struct E131Source {
+  uint8_t       cid[16];
+  uint8_t       priority;
+  uint8_t       sequence;
+  uint16_t      channels;
+  unsigned long lastSeen;  // 0 = slot unused
+  uint8_t      *data;      // last received data (allocated while universe has several sources)
+} e131_source_t;
+
+static e131_source_t e131Sources[E131_MAX_UNIVERSE_COUNT][E131_MAX_SOURCES];
+static uint8_t      *e131Merged[E131_MAX_UNIVERSE_COUNT]; // merged output (allocated while several sources have top priority)
+static bool          e131SourcesUsed = false;
+
+// per-byte maximum of 4 packed channels (SWAR: even and odd bytes are compared in 16 bit lanes)
+static inline uint32_t maxChannels4(uint32_t a, uint32_t b) {
+  uint32_t ae = a & 0x00FF00FF, be = b & 0x00FF00FF;
+  uint32_t ao = (a >> 8) & 0x00FF00FF, bo = (b >> 8) & 0x00FF00FF;
+  uint32_t me = (((ae | 0x01000100) - be) >> 8 & 0x00010001) * 0xFF; // 0xFF in lanes where a >= b
+  uint32_t mo = (((ao | 0x01000100) - bo) >> 8 & 0x00010001) * 0xFF;
+  return ((ae & me) | (be & ~me)) | (((ao & mo) | (bo & ~mo)) << 8);
+}
+
+static void freeSource(e131_source_t &src) {
+  p_free(src.data);
+  src.data = nullptr;
+  src.lastSeen = 0;
+}
+
+static void freeE131Sources() {
+  if (!e131SourcesUsed) return;
+  e131SourcesUsed = false;
+  for (unsigned idx = 0; idx < E131_MAX_UNIVERSE_COUNT; idx++) {
+    frameSources[idx] = 0;
+    for (e131_source_t &src : e131Sources[idx]) if (src.lastSeen) freeSource(src);
+    p_free(e131Merged[idx]);
+    e131Merged[idx] = nullptr;
+  }
+}
+
+// frees sources that stopped sending, returns number of remaining sources
+static unsigned expireSources(unsigned idx, unsigned long now) {
+  unsigned live = 0;
+  for (e131_source_t &src : e131Sources[idx]) {
+    if (!src.lastSeen) continue;
+    if (now - src.lastSeen > E131_SOURCE_TIMEOUT) freeSource(src);
+    else live++;
+  }
+  return live;
+}
+
+// remembers the data of a source (unsent channels are 0)
+static void storeSourceData(e131_source_t &src, const uint8_t *data, unsigned channels) {
+  memcpy(src.data + 4, data, channels);
+  if (channels < MAX_CHANNELS_PER_UNIVERSE) memset(src.data + 4 + channels, 0, MAX_CHANNELS_PER_UNIVERSE - channels);
+}
+
+// data points to DMX channel 1, returns channel data to use for this universe
+// or nullptr if the packet is to be ignored (lower priority, duplicate or no free source slot)
+static uint8_t *mergeSource(unsigned idx, const uint8_t *cid, uint8_t priority, int seq, uint8_t *data, int &dmxChannels) {
+  const unsigned long now = millis() | 1;
+  unsigned live = expireSources(idx, now);
+  e131SourcesUsed = true;
+
+  e131_source_t *src = nullptr;
+  for (e131_source_t &s : e131Sources[idx]) if (s.lastSeen && !memcmp(s.cid, cid, sizeof(s.cid))) { src = &s; break; }
+  if (!src) {
+    for (e131_source_t &s : e131Sources[idx]) if (!s.lastSeen) { src = &s; break; }
+    if (!src) { frameSources[idx] = live; return nullptr; } // too many sources
+    memcpy(src->cid, cid, sizeof(src->cid));
+    live++;
+  }
+  frameSources[idx] = live;
+  if (seq && src->lastSeen) {
+    int8_t age = seq - src->sequence;
+    if (age <= 0 && age > -20) { e131LateUniverses++; return nullptr; } // duplicate or out of order from this source
+  }
+  src->priority = priority;
+  src->sequence = seq;
+  src->channels = dmxChannels;
+  src->lastSeen = now;
+
+  if (live == 1) { // common case: single source, pass data through
+    p_free(src->data);
+    src->data = nullptr;
+    p_free(e131Merged[idx]);
+    e131Merged[idx] = nullptr;
+    return data;
+  }
+
+  uint8_t topPriority = 0;
+  unsigned numTop = 0;
+  for (const e131_source_t &s : e131Sources[idx]) {
+    if (!s.lastSeen) continue;
+    if (s.priority > topPriority) { topPriority = s.priority; numTop = 0; }
+    if (s.priority == topPriority) numTop++;
+  }
+
+  // several sources: keep their data so a remaining source can take over (or be merged) seamlessly
+  if (!src->data) src->data = static_cast<uint8_t*>(p_calloc(1, E131_MERGE_BUFSIZE));
+  if (!src->data) return priority == topPriority ? data : nullptr; // out of memory: last packet wins
+
+  if (priority < topPriority || numTop == 1) { // lower priority source is only remembered, sole top priority source is used as is
+    storeSourceData(*src, data, dmxChannels);
+    return priority == topPriority ? data : nullptr;
+  }
+
+  if (!e131Merged[idx]) {
+    e131Merged[idx] = static_cast<uint8_t*>(p_calloc(1, E131_MERGE_BUFSIZE));
+    if (!e131Merged[idx]) return data;
+    memcpy(e131Merged[idx] + 4, data, dmxChannels);
+  }
+  uint8_t *merged = e131Merged[idx] + 4;
+
+  if (e131MergeMode == E131_MERGE_LTP) {
+    // latest change takes precedence: take channels that changed since this source's previous packet
+    const uint8_t *old = src->data + 4;
+    for (int i = 0; i < dmxChannels; i++) if (data[i] != old[i]) merged[i] = data[i];
+    storeSourceData(*src, data, dmxChannels);
+  } else {
+    // highest value takes precedence
+    storeSourceData(*src, data, dmxChannels);
+    uint32_t *dst = reinterpret_cast<uint32_t*>(merged);
+    memset(dst, 0, MAX_CHANNELS_PER_UNIVERSE);
+    for (const e131_source_t &s : e131Sources[idx]) {
+      if (!s.lastSeen || s.priority != topPriority || !s.data) continue;
+      const uint32_t *in = reinterpret_cast<const uint32_t*>(s.data + 4);
+      for (unsigned i = 0; i < MAX_CHANNELS_PER_UNIVERSE/4; i++) dst[i] = maxChannels4(dst[i], in[i]);
+      if (s.channels > dmxChannels) dmxChannels = s.channels;
+    }
+  }
+  return merged;
+}
+
 //E1.31 and Art-Net protocol support
-void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_t packetLen){
+static void receiveE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_t packetLen){
 
   int uni = 0, dmxChannels = 0;
   uint8_t* e131_data = nullptr;
@@ -106,6 +558,11 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_
       handleArtnetPollReply(clientIP);
       return;
     }
+    if (p->art_opcode == ARTNET_OPCODE_OPSYNC) {
+      lastArtSync = millis() | 1;
+      finishFrame();
+      return;
+    }
     if (packetLen < 18) return; // need art_length (offset 16, 2 bytes) for DMX data
     uni = p->art_universe;
     dmxChannels = htons(p->art_length);
@@ -116,6 +573,11 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_
     seq = p->art_sequence_number;
     mde = REALTIME_MODE_ARTNET;
   } else if (protocol == P_E131) {
+    if (htonl(p->root_vector) == ESPAsyncE131::VECTOR_ROOT_EXTENDED) { // synchronization packet (validated by ESPAsyncE131)
+      const uint8_t *raw = reinterpret_cast<const uint8_t*>(p);
+      if (frameSyncAddress && ((raw[E131_SYNC_ADDRESS] << 8) | raw[E131_SYNC_ADDRESS+1]) == frameSyncAddress) finishFrame();
+      return;
+    }
     if (packetLen < 126) return; // need up to property_values[0] (offset 125) and property_value_count (offset 123)
     // Ignore PREVIEW data (E1.31: 6.2.6)
     if ((p->options & 0x80) != 0) return;
@@ -125,16 +587,23 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_
     uni = htons(p->universe);
     e131_data = p->property_values;
     seq = p->sequence_number;
+    frameSyncAddress = htons(p->reserved); // synchronization address (0 = source does not send sync packets)
     const int e131MaxData = (packetLen > 126) ? (int)(packetLen - 126) : 0; // property_values at offset 125; clamp so e131_data[dmxChannels] stays in bounds
     if (dmxChannels > e131MaxData) dmxChannels = e131MaxData;
     if (dmxChannels > MAX_CHANNELS_PER_UNIVERSE) dmxChannels = MAX_CHANNELS_PER_UNIVERSE;
     if (e131Priority != 0) {
       if (p->priority < e131Priority ) return;
-      // track highest priority & skip all lower priorities
-      if (p->priority >= highPriority.get()) highPriority.set(p->priority);
-      if (p->priority < highPriority.get()) return;
+      // track highest priority & skip all lower priorities (merge tracks priority per universe)
+      if (e131MergeMode == E131_MERGE_NONE) {
+        if (p->priority >= highPriority.get()) highPriority.set(p->priority);
+        if (p->priority < highPriority.get()) return;
+      }
     }
   } else { //DDP
+    if (packetLen >= WLED_STREAM_HEADER_LEN && !memcmp_P(p->raw, PSTR("WLDS"), 4)) { // WLED delta stream shares DDP port
+      handleStreamPacket(p->raw, packetLen, clientIP);
+      return;
+    }
     realtimeIP = clientIP;
     handleDDPPacket(p, packetLen);
     return;
@@ -156,20 +625,44 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_
 
   unsigned previousUniverses = uni - e131Universe;
 
+  if (e131MergeMode != E131_MERGE_NONE) {
+    uint8_t cid[16] = {0};
+    uint8_t priority = 100; // Art-Net has no priority, use E1.31 default
+    if (mde == REALTIME_MODE_ARTNET) {
+      for (size_t i = 0; i < 4; i++) cid[i] = clientIP[i];
+    } else {
+      memcpy(cid, p->cid, sizeof(cid));
+      priority = p->priority;
+    }
+    const unsigned startCode = mde != REALTIME_MODE_ARTNET; // E1.31 data is preceded by start code
+    uint8_t *channels = mergeSource(previousUniverses, cid, priority, seq, e131_data + startCode, dmxChannels);
+    if (!channels) return;
+    e131_data = channels - startCode;
+    seq = 0; // sequence was checked per source
+  }
+
   if (e131SkipOutOfSequence)
     if (seq < e131LastSequenceNumber[previousUniverses] && seq > 20 && e131LastSequenceNumber[previousUniverses] < 250){
       DEBUG_PRINTF_P(PSTR("skipping E1.31 frame (last seq=%d, current seq=%d, universe=%d)\n"), e131LastSequenceNumber[previousUniverses], seq, uni);
       return;
     }
+  if (!frameAcceptUniverse(previousUniverses, seq)) return;
   e131LastSequenceNumber[previousUniverses] = seq;
 
   // update status info
   realtimeIP = clientIP;
 
-  handleDMXData(uni, dmxChannels, e131_data, mde, previousUniverses);
+  if (handleDMXData(uni, dmxChannels, e131_data, mde, previousUniverses)) frameAddUniverse(previousUniverses);
+}
+
+// called from UDP and WebSocket receive tasks
+void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_t packetLen) {
+  lockE131Rx();
+  receiveE131Packet(p, clientIP, protocol, packetLen);
+  unlockE131Rx();
 }
 
-void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8_t mde, uint8_t previousUniverses) {
+bool handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8_t mde, uint8_t previousUniverses) {
   byte wChannel = 0;
   unsigned totalLen = strip.getLengthTotal();
   unsigned availDMXLen = 0;
@@ -190,16 +683,16 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
 
   switch (DMXMode) {
     case DMX_MODE_DISABLED:
-      return;  // nothing to do
+      return false;  // nothing to do
       break;
 
     case DMX_MODE_SINGLE_RGB:   // 3 channel: [R,G,B]
-      if (uni != e131Universe) return;
-      if (availDMXLen < 3) return;
+      if (uni != e131Universe) return false;
+      if (availDMXLen < 3) return false;
 
       realtimeLock(realtimeTimeoutMs, mde);
 
-      if (realtimeOverride) return;
+      if (realtimeOverride) return false;
 
       wChannel = (availDMXLen > 3) ? e131_data[dataOffset+3] : 0;
       for (unsigned i = 0; i < totalLen; i++)
@@ -207,11 +700,11 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
       break;
 
     case DMX_MODE_SINGLE_DRGB:  // 4 channel: [Dimmer,R,G,B]
-      if (uni != e131Universe) return;
-      if (availDMXLen < 4) return;
+      if (uni != e131Universe) return false;
+      if (availDMXLen < 4) return false;
 
       realtimeLock(realtimeTimeoutMs, mde);
-      if (realtimeOverride) return;
+      if (realtimeOverride) return false;
       wChannel = (availDMXLen > 4) ? e131_data[dataOffset+4] : 0;
 
       if (bri != e131_data[dataOffset+0]) {
@@ -225,7 +718,7 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
 
     case DMX_MODE_PRESET:       // 2 channel: [Dimmer,Preset]
       {
-        if (uni != e131Universe || availDMXLen < 2) return;
+        if (uni != e131Universe || availDMXLen < 2) return false;
 
         // limit max. selectable preset to 250, even though DMX max. val is 255
         int dmxValPreset = (e131_data[dataOffset+1] > 250 ? 250 : e131_data[dataOffset+1]);
@@ -244,7 +737,7 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
           strip.setBrightness(bri, false);
           stateUpdated(CALL_MODE_WS_SEND);
         }
-        return;
+        return false;
         break;
       }
 
@@ -253,7 +746,7 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
     case DMX_MODE_EFFECT_SEGMENT:   // 15 channels per segment;
     case DMX_MODE_EFFECT_SEGMENT_W: // 18 Channels per segment;
       {
-        if (uni != e131Universe) return;
+        if (uni != e131Universe) return false;
         bool isSegmentMode = DMXMode == DMX_MODE_EFFECT_SEGMENT || DMXMode == DMX_MODE_EFFECT_SEGMENT_W;
         unsigned dmxEffectChannels = (DMXMode == DMX_MODE_EFFECT || DMXMode == DMX_MODE_EFFECT_SEGMENT) ? 15 : 18;
         for (unsigned id = 0; id < strip.getSegmentsNum(); id++) {
@@ -267,7 +760,7 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
             dataOffset--;
           // Skip out of universe addresses
           if (dataOffset > dmxChannels - dmxEffectChannels + 1)
-            return;
+            return false;
 
           if (e131_data[dataOffset+1] < strip.getModeCount())
             if (e131_data[dataOffset+1] != seg.mode)      seg.setMode(   e131_data[dataOffset+1]);
@@ -310,7 +803,7 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
             }
           }
         }
-        return;
+        return false;
         break;
       }
       
@@ -325,7 +818,7 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
         unsigned previousLeds, dmxOffset, ledsTotal;
 
         if (previousUniverses == 0) {
-          if (availDMXLen < 1) return;
+          if (availDMXLen < 1) return false;
           dmxOffset = dataOffset;
           previousLeds = 0;
           // First DMX address is dimmer in DMX_MODE_MULTIPLE_DRGB mode.
@@ -346,11 +839,11 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
 
         // All LEDs already have values
         if (previousLeds >= totalLen) {
-          return;
+          return false;
         }
 
         realtimeLock(realtimeTimeoutMs, mde);
-        if (realtimeOverride) return;
+        if (realtimeOverride) return false;
 
         if (ledsTotal > totalLen) {
           ledsTotal = totalLen;
@@ -371,11 +864,11 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
       }
     default:
       DEBUG_PRINTLN(F("unknown E1.31 DMX mode"));
-      return;  // nothing to do
+      return false;  // nothing to do
       break;
   }
 
-  e131NewData = true;
+  return true;
 }
 
 static void handleArtnetPollReply(IPAddress ipAddress) {
@@ -576,9 +1069,11 @@ static void sendArtnetPollReply(ArtPollReply *reply, IPAddress ipAddress, uint16
     pollReplyCount = 0;
   }
 
+  lockUdpSockets();
   notifierUdp.beginPacket(ipAddress, ARTNET_DEFAULT_PORT);
   notifierUdp.write(reply->raw, sizeof(ArtPollReply));
   notifierUdp.endPacket();
+  unlockUdpSockets();
 
   reply->reply_bind_index++;
 }
\ No newline at end of file
@@ -110,7 +110,9 @@ void handleDMXInput();
 
 //e131.cpp
 void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol, size_t packetLen);
-void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8_t mde, uint8_t previousUniverses);
+void handleE131FrameTimeout();
+void handleRealtimePlayout();
+bool handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8_t mde, uint8_t previousUniverses); // returns true if LEDs need to be updated
 // void handleArtnetPollReply(IPAddress ipAddress);                                          // local function, only used in e131.cpp
 // void prepareArtnetPollReply(ArtPollReply* reply);                                         // local function, only used in e131.cpp
 // void sendArtnetPollReply(ArtPollReply* reply, IPAddress ipAddress, uint16_t portAddress); // local function, only used in e131.cpp
@@ -187,6 +189,10 @@ void serializeInfo(JsonObject root);
 void serializeModeNames(JsonArray arr);
 void serializePins(JsonObject root);
 void serveJson(AsyncWebServerRequest* request);
+struct PresetSnapshot;
+PresetSnapshot *compilePresetSnapshot(JsonObject root);
+void applyPresetSnapshot(const PresetSnapshot *snap);
+void freePresetSnapshot(PresetSnapshot *snap);
 #ifdef WLED_ENABLE_JSONLIVE
 bool serveLiveLeds(AsyncWebServerRequest* request, uint32_t wsClient = 0);
 #endif
@@ -278,6 +284,7 @@ void initPresetsFile();
 void handlePresets();
 bool applyPreset(byte index, byte callMode = CALL_MODE_DIRECT_CHANGE);
 bool applyPresetFromPlaylist(byte index);
+bool preparePreset(byte index);
 void applyPresetWithFallback(uint8_t presetID, uint8_t callMode, uint8_t effectID = 0, uint8_t paletteID = 0);
 inline bool applyTemporaryPreset() {return applyPreset(255);};
 void savePreset(byte index, const char* pname = nullptr, JsonObject saveobj = JsonObject());
@@ -297,12 +304,26 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply=tru
 //udp.cpp
 void notify(byte callMode, bool followUp=false);
 uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const uint8_t* buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcastE131(IPAddress client, uint16_t startUniverse, uint8_t* sequence, uint16_t length, const uint8_t* buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcastDelta(IPAddress client, uint16_t length, const uint8_t* buffer, uint8_t* reference, uint16_t frameSeq, bool keyframe, uint8_t bri=255, bool isRGBW=false);
+void requestRealtimeKeyframe(IPAddress receiver);
+#ifdef ARDUINO_ARCH_ESP32
+void setRealtimePacing(bool enable);
+#endif
 void realtimeLock(uint32_t timeoutMs, byte md = REALTIME_MODE_GENERIC);
 void exitRealtime();
 void handleNotifications();
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w);
+void setRealtimePixels(unsigned start, const uint8_t *data, unsigned count, unsigned channels);
 void refreshNodeList();
 void sendSysInfoUDP();
+#ifdef ARDUINO_ARCH_ESP32
+void lockUdpSockets();   // serialize socket use with the UDP receive task
+void unlockUdpSockets();
+#else
+inline void lockUdpSockets() {}
+inline void unlockUdpSockets() {}
+#endif
 #ifndef WLED_DISABLE_ESPNOW
 void espNowSentCB(uint8_t* address, uint8_t status);
 void espNowReceiveCB(uint8_t* address, uint8_t* data, uint8_t len, signed int rssi, bool broadcast);
@@ -608,6 +629,8 @@ void serveMessage(AsyncWebServerRequest* request, uint16_t code, const String& h
 void serveJsonError(AsyncWebServerRequest* request, uint16_t code, uint16_t error);
 void serveSettings(AsyncWebServerRequest* request, bool post = false);
 void serveSettingsJS(AsyncWebServerRequest* request);
+void setContentCacheHeaders(AsyncWebServerResponse *response, const char *etag);
+bool handleIfNoneMatch(AsyncWebServerRequest *request, const char *etag);
 
 //ws.cpp
 void handleWs();
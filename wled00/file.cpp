@@ -328,6 +328,84 @@ bool writeObjectToFile(const char* file, const char* key, const JsonDocument* co
   return true;
 }
 
+/*
+ * Preset index: file positions of the preset objects in presets.json, so loading a preset seeks
+ * directly instead of scanning the file. It is built in a single pass when presets.json changed
+ * (presetsVersion or size differ) and each entry is verified against the key in front of it.
+ */
+static std::vector<uint32_t> presetOffsets; // position after "<id>": for each preset ID, 0 if not present
+static uint16_t presetIndexVersion = 0;
+static size_t presetIndexFileSize = 0;
+static bool presetIndexBuilt = false;
+
+static void buildPresetIndex() {
+  #ifdef WLED_DEBUG_FS
+    uint32_t s = millis();
+  #endif
+  presetOffsets.clear();
+  byte buf[FS_BUFSIZE];
+  unsigned depth = 0;
+  bool inString = false, escaped = false;
+  unsigned keyState = 0; // 1: reading root level key, 2: key closed, 3: ':' seen (object value follows)
+  unsigned id = 0;
+  size_t pos = 0, valuePos = 0;
+  f.seek(0);
+  while (f.available()) {
+    size_t bufsize = f.read(buf, FS_BUFSIZE);
+    for (size_t i = 0; i < bufsize; i++, pos++) {
+      char c = buf[i];
+      if (inString) {
+        if (escaped)        escaped = false;
+        else if (c == '\\') escaped = true;
+        else if (c == '"')  { inString = false; if (keyState == 1) keyState = 2; }
+        else if (keyState == 1) {
+          if (c >= '0' && c <= '9' && id < 256) id = id*10 + c - '0';
+          else keyState = 0; // not a preset ID
+        }
+        continue;
+      }
+      switch (c) {
+        case '"': inString = true; keyState = (depth == 1); id = 0; break;
+        case ':': keyState = (keyState == 2) ? 3 : 0; valuePos = pos + 1; break;
+        case '{':
+          if (depth == 1 && keyState == 3 && id < 256) {
+            if (id >= presetOffsets.size()) presetOffsets.resize(id+1, 0);
+            presetOffsets[id] = valuePos;
+          }
+          depth++; keyState = 0; break;
+        case '}': if (depth) depth--; keyState = 0; break;
+        case ' ': case '\t': case '\r': case '\n': break; // whitespace (pretty-printed or hand-edited file)
+        default: keyState = 0; break;
+      }
+    }
+  }
+  presetIndexVersion  = presetsVersion;
+  presetIndexFileSize = f.size();
+  presetIndexBuilt    = true;
+  DEBUGFS_PRINTF("Preset index: %u IDs, took %lu ms\n", presetOffsets.size(), millis() - s);
+}
+
+// seeks to preset object in presets.json using the index, returns false if preset does not exist
+// an ID missing from a current index is not searched for; the index is only rebuilt if an entry does not verify
+// (file changed without presetsVersion update), the file is scanned only if a freshly built entry does not verify
+static bool findPreset(unsigned id, const char *key) {
+  size_t keyLen = strlen(key);
+  bool rebuilt = false;
+  if (!presetIndexBuilt || presetIndexVersion != presetsVersion || presetIndexFileSize != f.size()) {
+    buildPresetIndex();
+    rebuilt = true;
+  }
+  while (true) {
+    if (id >= presetOffsets.size() || presetOffsets[id] < keyLen) return false; // not in index
+    char buf[10];
+    f.seek(presetOffsets[id] - keyLen);
+    if (f.read((uint8_t*)buf, keyLen) == keyLen && !memcmp(buf, key, keyLen)) return true; // f now at value
+    if (rebuilt) return bufferedFind(key);
+    buildPresetIndex(); // stale entry
+    rebuilt = true;
+  }
+}
+
 bool readObjectFromFileUsingId(const char* file, uint16_t id, JsonDocument* dest, const JsonDocument* filter)
 {
   char objKey[10];
@@ -347,7 +425,14 @@ bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest, c
   f = WLED_FS.open(fileName, "r");
   if (!f) return false;
 
-  if (key != nullptr && !bufferedFind(key)) //key does not exist in file
+  // preset keys ("<id>": in presets.json) are found using the preset index
+  bool found = true;
+  if (key != nullptr) {
+    unsigned id = (key[0] == '"') ? atoi(key + 1) : 0;
+    if (id && strcmp_P(fileName, getPresetsFileName()) == 0) found = findPreset(id, key);
+    else found = bufferedFind(key);
+  }
+  if (!found) //key does not exist in file
   {
     f.close();
     dest->clear();
@@ -385,15 +470,15 @@ void updateFSInfo() {
 // original idea by @akaricchi (https://github.com/Akaricchi)
 // returns a pointer to the PSRAM buffer, updates size parameter
 static const uint8_t *getPresetCache(size_t &size) {
-  static unsigned long presetsCachedTime = 0;
+  static uint16_t presetsCachedVersion = 0;
   static uint8_t *presetsCached = nullptr;
   static size_t presetsCachedSize = 0;
   static byte presetsCachedValidate = 0;
 
-  //if (presetsModifiedTime != presetsCachedTime) DEBUG_PRINTLN(F("getPresetCache(): presetsModifiedTime changed."));
+  //if (presetsVersion != presetsCachedVersion) DEBUG_PRINTLN(F("getPresetCache(): presetsVersion changed."));
   //if (presetsCachedValidate != cacheInvalidate) DEBUG_PRINTLN(F("getPresetCache(): cacheInvalidate changed."));
 
-  if ((presetsModifiedTime != presetsCachedTime) || (presetsCachedValidate != cacheInvalidate)) {
+  if ((presetsVersion != presetsCachedVersion) || (presetsCachedValidate != cacheInvalidate)) {
     if (presetsCached) {
       p_free(presetsCached);
       presetsCached = nullptr;
@@ -404,7 +489,7 @@ static const uint8_t *getPresetCache(size_t &size) {
   if (!presetsCached) {
     File file = WLED_FS.open(FPSTR(getPresetsFileName()), "r");
     if (file) {
-      presetsCachedTime = presetsModifiedTime;
+      presetsCachedVersion = presetsVersion;
       presetsCachedValidate = cacheInvalidate;
       presetsCachedSize = 0;
       presetsCached = (uint8_t*)p_malloc(file.size() + 1);
@@ -426,17 +511,23 @@ bool handleFileRead(AsyncWebServerRequest* request, String path){
   DEBUGFS_PRINT(F("WS FileRead: ")); DEBUGFS_PRINTLN(path);
   if(path.endsWith("/")) path += "index.htm";
   if(path.indexOf(F("sec")) > -1) return false;
-  #ifdef BOARD_HAS_PSRAM
   if (path.endsWith(FPSTR(getPresetsFileName()))) {
+    char etag[24];
+    sprintf_P(etag, PSTR("p%lu-%04x-%02x"), presetsModifiedTime, presetsVersion, cacheInvalidate);
+    if (handleIfNoneMatch(request, etag)) return true;
+    AsyncWebServerResponse *response = nullptr;
+    #ifdef BOARD_HAS_PSRAM
     size_t psize;
     const uint8_t *presets = getPresetCache(psize);
-    if (presets) {
-      AsyncWebServerResponse *response = request->beginResponse_P(200, FPSTR(CONTENT_TYPE_JSON), presets, psize);
+    if (presets) response = request->beginResponse_P(200, FPSTR(CONTENT_TYPE_JSON), presets, psize);
+    #endif
+    if (!response && WLED_FS.exists(path)) response = request->beginResponse(WLED_FS, path, {}, request->hasArg(F("download")), {});
+    if (response) {
+      setContentCacheHeaders(response, etag);
       request->send(response);
       return true;
     }
   }
-  #endif
   if(WLED_FS.exists(path) || WLED_FS.exists(path + ".gz")) {
     request->send(request->beginResponse(WLED_FS, path, {}, request->hasArg(F("download")), {}));
     return true;
@@ -65,6 +65,182 @@ namespace {
 
     return d;
   }
+
+  SegmentCopy copySegment(const Segment& seg) {
+    return {
+      {seg.colors[0], seg.colors[1], seg.colors[2]},
+      seg.start,
+      seg.stop,
+      seg.offset,
+      seg.grouping,
+      seg.spacing,
+      seg.startY,
+      seg.stopY,
+      seg.options,
+      seg.mode,
+      seg.palette,
+      seg.opacity,
+      seg.speed,
+      seg.intensity,
+      seg.custom1,
+      seg.custom2,
+      seg.custom3,
+      seg.check1,
+      seg.check2,
+      seg.check3
+    };
+  }
+}
+
+// segment values resolved from JSON API (or a compiled preset), applied to the segment by applySegmentValues()
+typedef struct SegmentValues {
+  uint32_t colors[NUM_COLORS];
+  int32_t  offset;     // INT32_MAX keeps current offset
+  int      start, stop;
+  uint16_t startY, stopY, grouping, spacing, cct;
+  uint8_t  opacity, set, soundSim, map1D2D, mode, speed, intensity, palette, custom1, custom2, custom3, blendMode;
+  uint8_t  colorMask;  // colors to set
+  uint16_t fxMask;     // effect parameters to set (after effect change, which may load effect defaults)
+  bool     hasColors;  // "col" given (non RGB & non White segments are set to white/black)
+  bool     hasOpacity;
+  bool     fxDefaults;
+  bool     on, freeze, selected, reverse, mirror, reverse_y, mirror_y, transpose, check1, check2, check3;
+} segment_values_t;
+
+#define SEG_VAL_SX  0x0001
+#define SEG_VAL_IX  0x0002
+#define SEG_VAL_PAL 0x0004
+#define SEG_VAL_C1  0x0008
+#define SEG_VAL_C2  0x0010
+#define SEG_VAL_C3  0x0020
+#define SEG_VAL_O1  0x0040
+#define SEG_VAL_O2  0x0080
+#define SEG_VAL_O3  0x0100
+#define SEG_VAL_BM  0x0200
+#define SEG_VAL_ALL 0x03FF
+
+// values that leave the segment unchanged
+static segment_values_t segmentValues(const Segment &seg)
+{
+  segment_values_t v = {};
+  for (size_t i = 0; i < NUM_COLORS; i++) v.colors[i] = seg.colors[i];
+  v.offset    = INT32_MAX;
+  v.start     = seg.start;
+  v.stop      = seg.stop;
+  v.startY    = seg.startY;
+  v.stopY     = seg.stopY;
+  v.grouping  = seg.grouping;
+  v.spacing   = seg.spacing;
+  v.cct       = seg.cct;
+  v.opacity   = seg.opacity;
+  v.set       = seg.set;
+  v.soundSim  = seg.soundSim;
+  v.map1D2D   = seg.map1D2D;
+  v.mode      = seg.mode;
+  v.speed     = seg.speed;
+  v.intensity = seg.intensity;
+  v.palette   = seg.palette;
+  v.custom1   = seg.custom1;
+  v.custom2   = seg.custom2;
+  v.custom3   = seg.custom3;
+  v.blendMode = seg.blendMode;
+  v.on        = seg.on;
+  v.freeze    = seg.freeze;
+  v.selected  = seg.selected;
+  v.reverse   = seg.reverse;
+  v.mirror    = seg.mirror;
+  #ifndef WLED_DISABLE_2D
+  v.reverse_y = seg.reverse_y;
+  v.mirror_y  = seg.mirror_y;
+  v.transpose = seg.transpose;
+  #endif
+  v.check1    = seg.check1;
+  v.check2    = seg.check2;
+  v.check3    = seg.check3;
+  return v;
+}
+
+// applies resolved values to segment (used by JSON API and preset snapshots)
+// returns false if segment was deleted
+static bool applySegmentValues(Segment &seg, byte id, bool newSeg, const segment_values_t &v)
+{
+  // if segment's virtual dimensions change we need to restart effect (segment blending and PS rely on dimensions)
+  if (seg.mirror != v.mirror) seg.markForReset();
+  #ifndef WLED_DISABLE_2D
+  if (seg.mirror_y != v.mirror_y || seg.transpose != v.transpose) seg.markForReset();
+  #endif
+
+  int start = v.start;
+  int stop  = v.stop;
+  int len = (stop > start) ? stop - start : 1;
+  int of  = seg.offset;
+  if (v.offset != INT32_MAX) {
+    int offsetAbs = abs(v.offset);
+    if (offsetAbs > len - 1) offsetAbs %= len;
+    if (v.offset < 0) offsetAbs = len - offsetAbs;
+    of = offsetAbs;
+  }
+  if (stop > start && of > len -1) of = len -1;
+
+  // update segment (delete if necessary)
+  seg.setGeometry(start, stop, v.grouping, v.spacing, of, v.startY, v.stopY, v.map1D2D); // strip needs to be suspended for this to work without issues
+
+  if (newSeg) seg.refreshLightCapabilities(); // fix for #3403
+
+  if (seg.reset && seg.stop == 0) {
+    if (id == strip.getMainSegmentId()) strip.setMainSegmentId(0); // fix for #3403
+    return false; // segment was deleted & is marked for reset, no need to change anything else
+  }
+
+  if (v.hasOpacity) {
+    if (v.opacity > 0) seg.setOpacity(v.opacity); // use transition
+    seg.setOption(SEG_OPTION_ON, v.opacity); // use transition
+  }
+
+  seg.setOption(SEG_OPTION_ON, v.on); // use transition
+  seg.freeze = v.freeze;
+
+  seg.setCCT(v.cct);
+
+  if (v.hasColors) {
+    if (seg.getLightCapabilities() & 3) {
+      // segment has RGB or White
+      for (size_t i = 0; i < NUM_COLORS; i++) {
+        if (!(v.colorMask & (1 << i))) continue;
+        seg.setColor(i, v.colors[i]); // use transition
+        if (seg.mode == FX_MODE_STATIC) strip.trigger(); //instant refresh
+      }
+    } else {
+      // non RGB & non White segment (usually On/Off bus)
+      seg.setColor(0, ULTRAWHITE); // use transition
+      seg.setColor(1, BLACK); // use transition
+    }
+  }
+
+  seg.set       = constrain(v.set, 0, 3);
+  seg.soundSim  = constrain(v.soundSim, 0, 3);
+  seg.selected  = v.selected;
+  seg.reverse   = v.reverse;
+  seg.mirror    = v.mirror;
+  #ifndef WLED_DISABLE_2D
+  seg.reverse_y = v.reverse_y;
+  seg.mirror_y  = v.mirror_y;
+  seg.transpose = v.transpose;
+  #endif
+
+  if (v.mode != seg.mode) seg.setMode(v.mode, v.fxDefaults); // use transition (WARNING: may change map1D2D causing geometry change)
+
+  if (v.fxMask & SEG_VAL_SX) seg.speed     = v.speed;
+  if (v.fxMask & SEG_VAL_IX) seg.intensity = v.intensity;
+  if ((v.fxMask & SEG_VAL_PAL) && (seg.getLightCapabilities() & 1)) seg.setPalette(v.palette); // ignore palette for White and On/Off segments
+  if (v.fxMask & SEG_VAL_C1) seg.custom1   = v.custom1;
+  if (v.fxMask & SEG_VAL_C2) seg.custom2   = v.custom2;
+  if (v.fxMask & SEG_VAL_C3) seg.custom3   = constrain(v.custom3, 0, 31);
+  if (v.fxMask & SEG_VAL_O1) seg.check1    = v.check1;
+  if (v.fxMask & SEG_VAL_O2) seg.check2    = v.check2;
+  if (v.fxMask & SEG_VAL_O3) seg.check3    = v.check3;
+  if (v.fxMask & SEG_VAL_BM) seg.blendMode = v.blendMode;
+  return true;
 }
 
 static bool deserializeSegment(JsonObject elem, byte it, byte presetId = 0)
@@ -90,28 +266,8 @@ static bool deserializeSegment(JsonObject elem, byte it, byte presetId = 0)
   }
   // we do not want to make segment copy as it may use a lot of RAM (effect data and pixel buffer)
   // so we will create a copy of segment options and compare it with original segment when done processing
-  SegmentCopy prev = {
-    {seg.colors[0], seg.colors[1], seg.colors[2]},
-    seg.start,
-    seg.stop,
-    seg.offset,
-    seg.grouping,
-    seg.spacing,
-    seg.startY,
-    seg.stopY,
-    seg.options,
-    seg.mode,
-    seg.palette,
-    seg.opacity,
-    seg.speed,
-    seg.intensity,
-    seg.custom1,
-    seg.custom2,
-    seg.custom3,
-    seg.check1,
-    seg.check2,
-    seg.check3
-  };
+  SegmentCopy prev = copySegment(seg);
+  segment_values_t v = segmentValues(seg);
 
   int start = elem["start"] | seg.start;
   if (stop < 0) {
@@ -119,8 +275,8 @@ static bool deserializeSegment(JsonObject elem, byte it, byte presetId = 0)
     stop = (len > 0) ? start + len : seg.stop;
   }
   // 2D segments
-  int startY = elem["startY"] | seg.startY;
-  int stopY = elem["stopY"] | seg.stopY;
+  v.startY = elem["startY"] | seg.startY;
+  v.stopY  = elem["stopY"] | seg.stopY;
 
   //repeat, multiplies segment until all LEDs are used, or max segments reached
   bool repeat = elem["rpt"] | false;
@@ -150,118 +306,99 @@ static bool deserializeSegment(JsonObject elem, byte it, byte presetId = 0)
     seg.clearName();
   }
 
-  uint16_t grp       = elem["grp"] | seg.grouping;
-  uint16_t spc       = elem[F("spc")] | seg.spacing;
-  uint16_t of        = seg.offset;
-  uint8_t  soundSim  = elem["si"] | seg.soundSim;
-  uint8_t  map1D2D   = elem["m12"] | seg.map1D2D;
-  uint8_t  set       = elem[F("set")] | seg.set;
-  bool     selected  = getBoolVal(elem["sel"], seg.selected);
-  bool     reverse   = getBoolVal(elem["rev"], seg.reverse);
-  bool     mirror    = getBoolVal(elem["mi"] , seg.mirror);
-  #ifndef WLED_DISABLE_2D
-  bool     reverse_y = getBoolVal(elem["rY"]   , seg.reverse_y);
-  bool     mirror_y  = getBoolVal(elem["mY"]   , seg.mirror_y);
-  bool     transpose = getBoolVal(elem[F("tp")], seg.transpose);
-  #endif
-
-  // if segment's virtual dimensions change we need to restart effect (segment blending and PS rely on dimensions)
-  if (seg.mirror != mirror) seg.markForReset();
+  v.start     = start;
+  v.stop      = stop;
+  v.grouping  = elem["grp"] | seg.grouping;
+  v.spacing   = elem[F("spc")] | seg.spacing;
+  v.offset    = elem[F("of")] | INT32_MAX;
+  v.soundSim  = elem["si"] | seg.soundSim;
+  v.map1D2D   = elem["m12"] | seg.map1D2D;
+  v.set       = elem[F("set")] | seg.set;
+  v.selected  = getBoolVal(elem["sel"], seg.selected);
+  v.reverse   = getBoolVal(elem["rev"], seg.reverse);
+  v.mirror    = getBoolVal(elem["mi"] , seg.mirror);
   #ifndef WLED_DISABLE_2D
-  if (seg.mirror_y != mirror_y || seg.transpose != transpose) seg.markForReset();
+  v.reverse_y = getBoolVal(elem["rY"]   , seg.reverse_y);
+  v.mirror_y  = getBoolVal(elem["mY"]   , seg.mirror_y);
+  v.transpose = getBoolVal(elem[F("tp")], seg.transpose);
   #endif
 
-  int len = (stop > start) ? stop - start : 1;
-  int offset = elem[F("of")] | INT32_MAX;
-  if (offset != INT32_MAX) {
-    int offsetAbs = abs(offset);
-    if (offsetAbs > len - 1) offsetAbs %= len;
-    if (offset < 0) offsetAbs = len - offsetAbs;
-    of = offsetAbs;
-  }
-  if (stop > start && of > len -1) of = len -1;
-
-  // update segment (delete if necessary)
-  seg.setGeometry(start, stop, grp, spc, of, startY, stopY, map1D2D); // strip needs to be suspended for this to work without issues
-
-  if (newSeg) seg.refreshLightCapabilities(); // fix for #3403
-
-  if (seg.reset && seg.stop == 0) {
-    if (id == strip.getMainSegmentId()) strip.setMainSegmentId(0); // fix for #3403
-    return true; // segment was deleted & is marked for reset, no need to change anything else
-  }
-
-  byte segbri = seg.opacity;
-  if (getVal(elem["bri"], segbri)) {
-    if (segbri > 0) seg.setOpacity(segbri); // use transition
-    seg.setOption(SEG_OPTION_ON, segbri); // use transition
-  }
-
-  seg.setOption(SEG_OPTION_ON, getBoolVal(elem["on"], seg.on)); // use transition
-  seg.freeze = getBoolVal(elem["frz"], seg.freeze);
-
-  seg.setCCT(elem["cct"] | seg.cct);
+  v.hasOpacity = getVal(elem["bri"], v.opacity);
+  v.on         = getBoolVal(elem["on"], v.hasOpacity ? v.opacity > 0 : seg.on); // "bri" turns segment on/off first
+  v.freeze     = getBoolVal(elem["frz"], seg.freeze);
+  v.cct        = elem["cct"] | seg.cct;
 
   JsonArray colarr = elem["col"];
-  if (!colarr.isNull())
+  v.hasColors = !colarr.isNull();
+  if (v.hasColors)
   {
-    if (seg.getLightCapabilities() & 3) {
-      // segment has RGB or White
-      for (size_t i = 0; i < NUM_COLORS; i++) {
-        // JSON "col" array can contain the following values for each of segment's colors (primary, background, custom):
-        // "col":[int|string|object|array, int|string|object|array, int|string|object|array]
-        //   int = Kelvin temperature or 0 for black
-        //   string = hex representation of [WW]RRGGBB or "r" for random color
-        //   object = individual channel control {"r":0,"g":127,"b":255,"w":255}, each being optional (valid to send {})
-        //   array = direct channel values [r,g,b,w] (w element being optional)
-        int rgbw[] = {0,0,0,0};
-        bool colValid = false;
-        JsonArray colX = colarr[i];
-        if (colX.isNull()) {
-          JsonObject oCol = colarr[i];
-          if (!oCol.isNull()) {
-            // we have a JSON object for color {"w":123,"r":123,...}; allows individual channel control
-            rgbw[0] = oCol["r"] | R(seg.colors[i]);
-            rgbw[1] = oCol["g"] | G(seg.colors[i]);
-            rgbw[2] = oCol["b"] | B(seg.colors[i]);
-            rgbw[3] = oCol["w"] | W(seg.colors[i]);
+    for (size_t i = 0; i < NUM_COLORS; i++) {
+      // JSON "col" array can contain the following values for each of segment's colors (primary, background, custom):
+      // "col":[int|string|object|array, int|string|object|array, int|string|object|array]
+      //   int = Kelvin temperature or 0 for black
+      //   string = hex representation of [WW]RRGGBB or "r" for random color
+      //   object = individual channel control {"r":0,"g":127,"b":255,"w":255}, each being optional (valid to send {})
+      //   array = direct channel values [r,g,b,w] (w element being optional)
+      int rgbw[] = {0,0,0,0};
+      bool colValid = false;
+      JsonArray colX = colarr[i];
+      if (colX.isNull()) {
+        JsonObject oCol = colarr[i];
+        if (!oCol.isNull()) {
+          // we have a JSON object for color {"w":123,"r":123,...}; allows individual channel control
+          rgbw[0] = oCol["r"] | R(seg.colors[i]);
+          rgbw[1] = oCol["g"] | G(seg.colors[i]);
+          rgbw[2] = oCol["b"] | B(seg.colors[i]);
+          rgbw[3] = oCol["w"] | W(seg.colors[i]);
+          colValid = true;
+        } else {
+          byte brgbw[] = {0,0,0,0};
+          const char* hexCol = colarr[i];
+          if (hexCol == nullptr) { //Kelvin color temperature (or invalid), e.g 2400
+            int kelvin = colarr[i] | -1;
+            if (kelvin <  0) continue;
+            if (kelvin >  0) colorKtoRGB(kelvin, brgbw); // 0 is black
             colValid = true;
-          } else {
-            byte brgbw[] = {0,0,0,0};
-            const char* hexCol = colarr[i];
-            if (hexCol == nullptr) { //Kelvin color temperature (or invalid), e.g 2400
-              int kelvin = colarr[i] | -1;
-              if (kelvin <  0) continue;
-              if (kelvin == 0) seg.setColor(i, 0);
-              if (kelvin >  0) colorKtoRGB(kelvin, brgbw);
-              colValid = true;
-            } else if (hexCol[0] == 'r' && hexCol[1] == '\0') { // Random colors via JSON API in Segment object like col=["r","r","r"] · Issue #4996
-              setRandomColor(brgbw);
-              colValid = true;
-            } else { //HEX string, e.g. "FFAA00"
-              colValid = colorFromHexString(brgbw, hexCol);
-            }
-            for (size_t c = 0; c < 4; c++) rgbw[c] = brgbw[c];
+          } else if (hexCol[0] == 'r' && hexCol[1] == '\0') { // Random colors via JSON API in Segment object like col=["r","r","r"] · Issue #4996
+            setRandomColor(brgbw);
+            colValid = true;
+          } else { //HEX string, e.g. "FFAA00"
+            colValid = colorFromHexString(brgbw, hexCol);
           }
-        } else { //Array of ints (RGB or RGBW color), e.g. [255,160,0]
-          byte sz = colX.size();
-          if (sz == 0) continue; //do nothing on empty array
-          copyArray(colX, rgbw, 4);
-          colValid = true;
+          for (size_t c = 0; c < 4; c++) rgbw[c] = brgbw[c];
         }
+      } else { //Array of ints (RGB or RGBW color), e.g. [255,160,0]
+        byte sz = colX.size();
+        if (sz == 0) continue; //do nothing on empty array
+        copyArray(colX, rgbw, 4);
+        colValid = true;
+      }
 
-        if (!colValid) continue;
+      if (!colValid) continue;
 
-        seg.setColor(i, RGBW32(rgbw[0],rgbw[1],rgbw[2],rgbw[3])); // use transition
-        if (seg.mode == FX_MODE_STATIC) strip.trigger(); //instant refresh
-      }
-    } else {
-      // non RGB & non White segment (usually On/Off bus)
-      seg.setColor(0, ULTRAWHITE); // use transition
-      seg.setColor(1, BLACK); // use transition
+      v.colors[i] = RGBW32(rgbw[0],rgbw[1],rgbw[2],rgbw[3]);
+      v.colorMask |= 1 << i;
     }
   }
 
+  if (getVal(elem["fx"], v.mode, 0, strip.getModeCount())) {
+    if (!presetId && currentPlaylist>=0) unloadPlaylist();
+  }
+  v.fxDefaults = elem[F("fxdef")];
+
+  if (getVal(elem["sx"], v.speed))                         v.fxMask |= SEG_VAL_SX;
+  if (getVal(elem["ix"], v.intensity))                     v.fxMask |= SEG_VAL_IX;
+  if (getVal(elem["pal"], v.palette, 0, getPaletteCount())) v.fxMask |= SEG_VAL_PAL;
+  if (getVal(elem["c1"], v.custom1))                       v.fxMask |= SEG_VAL_C1;
+  if (getVal(elem["c2"], v.custom2))                       v.fxMask |= SEG_VAL_C2;
+  if (getVal(elem["c3"], v.custom3, 0, 31))                v.fxMask |= SEG_VAL_C3;
+  if (!elem["o1"].isNull()) { v.check1 = getBoolVal(elem["o1"], seg.check1); v.fxMask |= SEG_VAL_O1; }
+  if (!elem["o2"].isNull()) { v.check2 = getBoolVal(elem["o2"], seg.check2); v.fxMask |= SEG_VAL_O2; }
+  if (!elem["o3"].isNull()) { v.check3 = getBoolVal(elem["o3"], seg.check3); v.fxMask |= SEG_VAL_O3; }
+  if (getVal(elem["bm"], v.blendMode))                     v.fxMask |= SEG_VAL_BM;
+
+  if (!applySegmentValues(seg, id, newSeg, v)) return true; // segment was deleted & is marked for reset, no need to change anything else
+
   // lx parser
   #ifdef WLED_ENABLE_LOXONE
   int lx = elem[F("lx")] | -1;
@@ -274,43 +411,6 @@ static bool deserializeSegment(JsonObject elem, byte it, byte presetId = 0)
   }
   #endif
 
-  seg.set       = constrain(set, 0, 3);
-  seg.soundSim  = constrain(soundSim, 0, 3);
-  seg.selected  = selected;
-  seg.reverse   = reverse;
-  seg.mirror    = mirror;
-  #ifndef WLED_DISABLE_2D
-  seg.reverse_y = reverse_y;
-  seg.mirror_y  = mirror_y;
-  seg.transpose = transpose;
-  #endif
-
-  byte fx = seg.mode;
-  if (getVal(elem["fx"], fx, 0, strip.getModeCount())) {
-    if (!presetId && currentPlaylist>=0) unloadPlaylist();
-    if (fx != seg.mode) seg.setMode(fx, elem[F("fxdef")]); // use transition (WARNING: may change map1D2D causing geometry change)
-  }
-
-  getVal(elem["sx"], seg.speed);
-  getVal(elem["ix"], seg.intensity);
-
-  uint8_t pal = seg.palette;
-  if (seg.getLightCapabilities() & 1) {  // ignore palette for White and On/Off segments
-    if (getVal(elem["pal"], pal, 0, getPaletteCount())) seg.setPalette(pal);
-  }
-
-  getVal(elem["c1"], seg.custom1);
-  getVal(elem["c2"], seg.custom2);
-  uint8_t cust3 = seg.custom3;
-  getVal(elem["c3"], cust3, 0, 31); // we can't pass reference to bitfield
-  seg.custom3 = constrain(cust3, 0, 31);
-
-  seg.check1 = getBoolVal(elem["o1"], seg.check1);
-  seg.check2 = getBoolVal(elem["o2"], seg.check2);
-  seg.check3 = getBoolVal(elem["o3"], seg.check3);
-
-  getVal(elem["bm"], seg.blendMode);
-
   JsonArray iarr = elem[F("i")]; //set individual LEDs
   if (!iarr.isNull()) {
     // set brightness immediately and disable transition
@@ -573,6 +673,217 @@ bool deserializeState(JsonObject root, byte callMode, byte presetId)
   return stateResponse;
 }
 
+/*
+ * Preset snapshots: presets holding the complete state of all segments (as saved from the UI with segment bounds)
+ * give the same result whatever the current state is, so they are compiled into a binary form that can be applied
+ * without reading flash or parsing JSON (the JSON buffer lock is still held). Applying one does what deserializeState() does with its JSON.
+ */
+typedef struct PresetSegment {
+  segment_values_t values;
+  char    *name;  // nullptr if unnamed
+  uint8_t  id;
+  bool     full;  // false for {"stop":0} entries (segment not part of preset)
+  bool     has2D; // startY, stopY, rY, mY, tp present
+} preset_segment_t;
+
+struct PresetSnapshot {
+  int16_t  bri, on, transition, bs, mainseg; // -1 if not present
+  uint8_t  segCount;
+  preset_segment_t *seg;
+};
+
+// all keys written by serializeSegment() for presets with segment bounds
+static const char *const snapshotSegKeys[] = {
+  "start", "stop", "grp", "spc", "of", "on", "frz", "bri", "cct", "set", "n", "col", "fx", "sx", "ix", "pal",
+  "c1", "c2", "c3", "sel", "rev", "mi", "o1", "o2", "o3", "si", "m12", "bm"
+};
+
+static bool compileSnapshotSegment(JsonObject elem, byte it, preset_segment_t &s)
+{
+  memset(&s, 0, sizeof(s));
+  s.id = elem["id"] | it;
+  if (elem["stop"] == 0 && elem.size() <= 1U + elem.containsKey("id")) return true; // segment not part of preset
+
+  // values must be plain (no "~" increments, "r" random, "t" toggle), else the result depends on current state
+  for (const char *key : snapshotSegKeys) if (!elem.containsKey(key)) return false;
+  if (elem.containsKey(F("rpt")) || elem.containsKey(F("i")) || elem.containsKey("len") || elem.containsKey(F("fxdef")) ||
+      elem.containsKey(F("lx")) || elem.containsKey(F("ly"))) return false;
+  segment_values_t &v = s.values;
+  auto u8   = [&](const char *key, uint8_t &val)  { if (!elem[key].is<uint8_t>())  return false; val = elem[key]; return true; };
+  auto u16  = [&](const char *key, uint16_t &val) { if (!elem[key].is<uint16_t>()) return false; val = elem[key]; return true; };
+  auto flag = [&](const char *key, bool &val)     { if (!elem[key].is<bool>())     return false; val = elem[key]; return true; };
+  if (!elem["start"].is<uint16_t>() || !elem["stop"].is<uint16_t>() || !elem["of"].is<int>() || !u16("grp", v.grouping) || !u16("spc", v.spacing) ||
+      !u8("bri", v.opacity) || !u16("cct", v.cct) || !u8("set", v.set) || !u8("fx", v.mode) || !u8("sx", v.speed) || !u8("ix", v.intensity) ||
+      !u8("pal", v.palette) || !u8("c1", v.custom1) || !u8("c2", v.custom2) || !u8("c3", v.custom3) || !u8("si", v.soundSim) ||
+      !u8("m12", v.map1D2D) || !u8("bm", v.blendMode) || !flag("on", v.on) || !flag("frz", v.freeze) || !flag("sel", v.selected) ||
+      !flag("rev", v.reverse) || !flag("mi", v.mirror) || !flag("o1", v.check1) || !flag("o2", v.check2) || !flag("o3", v.check3) ||
+      !elem["n"].is<const char*>()) return false;
+  // same validation as deserializeSegment(), presets with unknown effects are only applied from JSON
+  if (!getVal(elem["fx"], v.mode, 0, strip.getModeCount()) || v.mode >= strip.getModeCount() || !getVal(elem["pal"], v.palette, 0, getPaletteCount()) ||
+      !getVal(elem["c3"], v.custom3, 0, 31)) return false;
+  v.start  = elem["start"];
+  v.stop   = elem["stop"];
+  v.offset = elem["of"];
+  v.hasOpacity = true;
+  v.fxMask = SEG_VAL_ALL;
+
+  unsigned n2D = elem.containsKey(F("startY")) + elem.containsKey(F("stopY")) + elem.containsKey("rY") + elem.containsKey("mY") + elem.containsKey(F("tp"));
+  if (n2D == 5) {
+    if (!u16("startY", v.startY) || !u16("stopY", v.stopY) || !flag("rY", v.reverse_y) || !flag("mY", v.mirror_y) || !flag("tp", v.transpose)) return false;
+    s.has2D = true;
+  } else if (n2D) return false;
+
+  JsonArray colarr = elem["col"];
+  if (colarr.isNull() || colarr.size() > NUM_COLORS) return false;
+  v.hasColors = true;
+  for (size_t i = 0; i < colarr.size(); i++) {
+    JsonArray colX = colarr[i];
+    if (colX.isNull()) return false; // only [r,g,b(,w)] arrays
+    if (colX.size() == 0) continue;
+    int rgbw[] = {0,0,0,0};
+    copyArray(colX, rgbw, 4);
+    v.colors[i] = RGBW32(rgbw[0],rgbw[1],rgbw[2],rgbw[3]);
+    v.colorMask |= 1 << i;
+  }
+
+  const char *name = elem["n"];
+  if (name[0]) {
+    s.name = static_cast<char*>(p_malloc(strlen(name) + 1));
+    if (!s.name) return false;
+    strcpy(s.name, name);
+  }
+  s.full = true;
+  return true;
+}
+
+void freePresetSnapshot(PresetSnapshot *snap)
+{
+  if (!snap) return;
+  if (snap->seg) for (size_t i = 0; i < snap->segCount; i++) p_free(snap->seg[i].name);
+  p_free(snap->seg);
+  p_free(snap);
+}
+
+// returns nullptr if preset can not be compiled (only applied from JSON)
+PresetSnapshot *compilePresetSnapshot(JsonObject root)
+{
+  for (JsonPair kv : root) {
+    const char *key = kv.key().c_str();
+    if (strcmp(key, "n") && strcmp(key, "ql") && strcmp(key, "on") && strcmp(key, "bri") && strcmp(key, "bs") &&
+        strcmp_P(key, PSTR("transition")) && strcmp_P(key, PSTR("mainseg")) && strcmp(key, "seg")) return nullptr; // e.g. "win", "playlist", "nl", usermod keys
+  }
+  JsonArray segs = root["seg"];
+  if (segs.isNull() || segs.size() == 0 || segs.size() > WS2812FX::getMaxSegments()) return nullptr;
+  if ((!root["on"].isNull() && !root["on"].is<bool>()) || (!root["bri"].isNull() && !root["bri"].is<uint8_t>()) ||
+      (!root[F("transition")].isNull() && !root[F("transition")].is<uint16_t>()) || (!root[F("bs")].isNull() && !root[F("bs")].is<uint8_t>()) ||
+      (!root[F("mainseg")].isNull() && !root[F("mainseg")].is<uint8_t>())) return nullptr;
+
+  PresetSnapshot *snap = static_cast<PresetSnapshot*>(p_malloc(sizeof(PresetSnapshot)));
+  if (!snap) return nullptr;
+  snap->segCount = 0;
+  snap->seg = static_cast<preset_segment_t*>(p_calloc(segs.size(), sizeof(preset_segment_t)));
+  if (!snap->seg) { freePresetSnapshot(snap); return nullptr; }
+  snap->bri        = root["bri"].isNull()          ? -1 : root["bri"].as<int>();
+  snap->on         = root["on"].isNull()           ? -1 : root["on"].as<bool>();
+  snap->transition = root[F("transition")].isNull() ? -1 : root[F("transition")].as<int>();
+  snap->bs         = root[F("bs")].isNull()         ? -1 : root[F("bs")].as<int>();
+  snap->mainseg    = root[F("mainseg")].isNull()    ? -1 : root[F("mainseg")].as<int>();
+  for (JsonObject elem : segs) {
+    if (!compileSnapshotSegment(elem, snap->segCount, snap->seg[snap->segCount])) { freePresetSnapshot(snap); return nullptr; }
+    snap->segCount++;
+  }
+  return snap;
+}
+
+// same as deserializeSegment() with the JSON object the segment was compiled from
+static bool applySnapshotSegment(const preset_segment_t &e)
+{
+  byte id = e.id;
+  if (id >= WS2812FX::getMaxSegments()) return false;
+
+  bool newSeg = false;
+  if (id >= strip.getSegmentsNum()) {
+    if (!e.full || e.values.stop == 0) return false; // ignore empty/inactive segments
+    strip.appendSegment(0, strip.getLengthTotal());
+    id = strip.getSegmentsNum()-1; // segments are added at the end of list
+    newSeg = true;
+  }
+
+  Segment& seg = strip.getSegment(id);
+  SegmentCopy prev = copySegment(seg);
+  segment_values_t v = e.values;
+  if (!e.full) { // {"stop":0}
+    v = segmentValues(seg);
+    v.stop = 0;
+  } else if (!e.has2D) {
+    v.startY    = seg.startY;
+    v.stopY     = seg.stopY;
+    #ifndef WLED_DISABLE_2D
+    v.reverse_y = seg.reverse_y;
+    v.mirror_y  = seg.mirror_y;
+    v.transpose = seg.transpose;
+    #endif
+  }
+
+  if (e.full) seg.setName(e.name); // will resolve empty and null correctly
+  else if (v.start != seg.start || v.stop != seg.stop) seg.clearName();
+
+  if (!applySegmentValues(seg, id, newSeg, v)) return true; // segment was deleted
+
+  // send UDP/WS if segment options changed (except selection; will also deselect current preset)
+  if (differs(seg, prev) & ~SEG_DIFFERS_SEL) stateChanged = true;
+  return true;
+}
+
+// same as deserializeState(root, CALL_MODE_NO_NOTIFY, presetId) with the JSON the snapshot was compiled from
+// caller must hold the JSON buffer lock (segments may be changed by JSON API from async web server)
+void applyPresetSnapshot(const PresetSnapshot *snap)
+{
+  bool onBefore = bri;
+  if (snap->bri >= 0) bri = snap->bri;
+  if (bri != briOld) stateChanged = true;
+
+  bool on = (snap->on >= 0) ? snap->on : (bri > 0);
+  if (!on != !bri) toggleOnOff();
+
+  if (bri && !onBefore) { // unfreeze all segments when turning on
+    for (size_t s=0; s < strip.getSegmentsNum(); s++) {
+      strip.getSegment(s).freeze = false;
+    }
+    if (realtimeMode && !realtimeOverride && useMainSegmentOnly) { // keep live segment frozen if live
+      strip.getMainSegment().freeze = true;
+    }
+  }
+
+  if (currentPlaylist < 0 && snap->transition >= 0) { //do not apply transition time from preset if playlist active
+    transitionDelay = snap->transition * 100;
+    strip.setTransition(transitionDelay);
+  }
+  if (snap->bs >= 0) blendingStyle = snap->bs & 0x1F;
+
+  if (!realtimeMode && snap->mainseg >= 0) strip.setMainSegmentId(snap->mainseg);
+  if (realtimeMode && useMainSegmentOnly) {
+    strip.getMainSegment().freeze = !realtimeOverride;
+    realtimeOverride = REALTIME_OVERRIDE_NONE;  // ignore request for override if using main segment only
+  }
+
+  // we may be called during strip.service() so we must not modify segments while effects are executing
+  strip.suspend();
+  strip.waitForIt();
+  size_t deleted = 0;
+  for (size_t i = 0; i < snap->segCount; i++) {
+    if (applySnapshotSegment(snap->seg[i]) && (!snap->seg[i].full || snap->seg[i].values.stop == 0)) deleted++;
+  }
+  if (strip.getSegmentsNum() > 3 && deleted >= strip.getSegmentsNum()/2U) strip.purgeSegments(); // batch deleting more than half segments
+  strip.resume();
+
+  // compiled presets contain no usermod keys, usermods still get notified of the state change
+  JsonObject root = pDoc->to<JsonObject>();
+  UsermodManager::readFromJsonState(root);
+
+  if (stateChanged) stateUpdated(CALL_MODE_NO_NOTIFY);
+}
+
 static void serializeSegment(JsonObject& root, const Segment& seg, byte id, bool forPreset, bool segmentBounds)
 {
   root["id"] = id;
@@ -597,6 +908,7 @@ static void serializeSegment(JsonObject& root, const Segment& seg, byte id, bool
   root["cct"]    = seg.cct;
   root[F("set")] = seg.set;
   root["lc"]     = seg.getLightCapabilities();
+  if (!forPreset && seg.getParticleCount()) root[F("np")] = seg.getParticleCount(); // effective particle count of particle system FX
 
   if (seg.name != nullptr) root["n"] = reinterpret_cast<const char *>(seg.name); //not good practice, but decreases required JSON buffer
   else if (forPreset) root["n"] = "";
@@ -728,6 +1040,12 @@ void serializeInfo(JsonObject root)
   //leds[F("actseg")] = strip.getActiveSegmentsNum();
   //leds[F("seglock")] = false; //might be used in the future to prevent modifications to segment config
   leds[F("bootps")] = bootPreset;
+  JsonArray txt = leds.createNestedArray(F("txt")); // per bus transmit time of last frame in us
+  for (size_t b = 0; b < BusManager::getNumBusses(); b++) txt.add(BusManager::getBus(b)->getTransmitTime());
+  #ifdef ARDUINO_ARCH_ESP32
+  leds[F("netdrop")] = BusNetwork::getDroppedFrames(); // network bus frames dropped because sender task could not keep up
+  leds[F("netq")]    = BusNetwork::getMaxQueueDepth();
+  #endif
 
   #ifndef WLED_DISABLE_2D
   if (strip.isMatrix) {
@@ -782,9 +1100,31 @@ void serializeInfo(JsonObject root)
     case REALTIME_MODE_TPM2NET:  root["lm"] = F("tpm2.net"); break;
     case REALTIME_MODE_DDP:      root["lm"] = F("DDP"); break;
     case REALTIME_MODE_DMX:      root["lm"] = F("DMX"); break;
+    case REALTIME_MODE_WLED:     root["lm"] = F("WLED stream"); break;
   }
 
   root[F("lip")] = realtimeIP[0] == 0 ? "" : realtimeIP.toString();
+  if (e131LateUniverses || e131DroppedUniverses) {
+    root[F("e131late")] = e131LateUniverses;    // universes that arrived after their frame was shown
+    root[F("e131drop")] = e131DroppedUniverses; // universes missing when a frame was shown
+  }
+  if (udpConnected) {
+    JsonObject udprx = root.createNestedObject(F("udprx"));
+    udprx[F("pps")]  = udpRxRate;
+    udprx[F("pkt")]  = udpRxPackets;
+    udprx[F("drop")] = udpRxDropped;
+    udprx[F("skip")] = udpRxSkipped;
+  }
+  if (clockSyncRTT) {
+    JsonObject clk = root.createNestedObject(F("clk"));
+    clk[F("rtt")] = clockSyncRTT;   // us
+    clk[F("ppm")] = clockSyncDrift;
+  }
+  if (realtimeMode == REALTIME_MODE_DDP || realtimeMode == REALTIME_MODE_WLED) root[F("rtjit")] = realtimeJitter; // ms
+  if (realtimeFramesLate || realtimeFramesDropped) {
+    root[F("rtlate")] = realtimeFramesLate;     // buffered frames that missed their show time
+    root[F("rtdrop")] = realtimeFramesDropped;  // buffered frames dropped on overflow
+  }
 
   #ifdef WLED_ENABLE_WEBSOCKETS
   root[F("ws")] = ws.count();
@@ -1287,14 +1627,24 @@ static size_t writeJSONStringElement(uint8_t* dest, size_t maxLen, const char* s
   return 1 + n;
 }
 
+// ETag of metadata that only changes with firmware, registered effects or palettes (uploads bump cacheInvalidate)
+static void metadataEtag(char *etag, char kind) {
+  static uint16_t bootNonce = 0; // cacheInvalidate restarts at 0, custom palettes may have been edited before reboot
+  if (!bootNonce) bootNonce = hw_random16() | 1;
+  sprintf_P(etag, PSTR("%c%u-%04x-%02x-%u-%u"), kind, VERSION, bootNonce, cacheInvalidate, strip.getModeCount(), (unsigned)getPaletteCount());
+}
+
 // Generate a streamed JSON response for the mode data
 // This uses sendChunked to send the reply in blocks based on how much fit in the outbound
 // packet buffer, minimizing the required state (ie. just the next index to send).  This
 // allows us to send an arbitrarily large response without using any significant amount of
 // memory (so no worries about buffer limits).
 void respondModeData(AsyncWebServerRequest* request) {
+  char etag[40];
+  metadataEtag(etag, 'd');
+  if (handleIfNoneMatch(request, etag)) return;
   size_t fx_index = 0;
-  request->sendChunked(FPSTR(CONTENT_TYPE_JSON),
+  AsyncWebServerResponse *response = request->beginChunkedResponse(FPSTR(CONTENT_TYPE_JSON),
     [fx_index](uint8_t* data, size_t len, size_t) mutable {
       size_t bytes_written = 0;
       char lineBuffer[256];
@@ -1321,6 +1671,8 @@ void respondModeData(AsyncWebServerRequest* request) {
 
       return bytes_written;
   });
+  setContentCacheHeaders(response, etag);
+  request->send(response);
 }
 
 // Global buffer locking response helper class (to make sure lock is released when AsyncJsonResponse is destroyed)
@@ -1347,6 +1699,24 @@ class LockedJsonResponse: public AsyncJsonResponse {
   virtual ~LockedJsonResponse() { if (_holding_lock) releaseJSONBufferLock(); };
 };
 
+// serialized JSON owned by the response, sent in chunks as the client reads it (shared JSON buffer is not held)
+class JsonTextResponse: public AsyncAbstractResponse {
+  char *_text;
+  public:
+  JsonTextResponse(char *text, size_t len) : _text(text) {
+    _code = 200;
+    _contentType = FPSTR(CONTENT_TYPE_JSON);
+    _contentLength = len;
+  }
+  virtual ~JsonTextResponse() { p_free(_text); }
+  bool _sourceValid() const { return _text != nullptr; }
+  virtual size_t _fillBuffer(uint8_t *buf, size_t maxLen) {
+    size_t len = min(maxLen, _contentLength - _sentLength);
+    memcpy(buf, _text + _sentLength, len);
+    return len;
+  }
+};
+
 void serveJson(AsyncWebServerRequest* request)
 {
   enum class json_target {
@@ -1372,7 +1742,12 @@ void serveJson(AsyncWebServerRequest* request)
   }
   #endif
   else if (url.indexOf("pal") > 0) {
-    request->send_P(200, FPSTR(CONTENT_TYPE_JSON), JSON_palette_names);
+    char etag[40];
+    metadataEtag(etag, 'n');
+    if (handleIfNoneMatch(request, etag)) return;
+    AsyncWebServerResponse *response = request->beginResponse_P(200, FPSTR(CONTENT_TYPE_JSON), JSON_palette_names);
+    setContentCacheHeaders(response, etag);
+    request->send(response);
     return;
   }
   else if (url.length() > 6) { //not just /json
@@ -1380,6 +1755,39 @@ void serveJson(AsyncWebServerRequest* request)
     return;
   }
 
+  // state and info (most frequently polled) are serialized under the lock and sent as text owned by the response,
+  // so the shared buffer is not held while slow clients read; falls back to the locked response if out of memory
+  if (subJson == json_target::state || subJson == json_target::info || subJson == json_target::state_info) {
+    if (!requestJSONBufferLock(JSON_LOCK_SERVEJSON)) {
+      request->deferResponse();
+      return;
+    }
+    JsonObject root = pDoc->to<JsonObject>();
+    if (subJson == json_target::state_info) {
+      JsonObject state = root.createNestedObject("state");
+      serializeState(state);
+      JsonObject info = root.createNestedObject("info");
+      serializeInfo(info);
+    } else if (subJson == json_target::state) serializeState(root);
+    else                                      serializeInfo(root);
+    size_t len = measureJson(*pDoc);
+    char *text = static_cast<char*>(p_malloc(len + 1));
+    if (text) serializeJson(*pDoc, text, len + 1);
+    DEBUG_PRINTF_P(PSTR("JSON buffer size: %u, content length: %u\n"), pDoc->memoryUsage(), len);
+    releaseJSONBufferLock();
+    if (text) {
+      request->send(new JsonTextResponse(text, len));
+      return;
+    }
+  }
+
+  // effect names and palettes rarely change, browsers revalidate them with If-None-Match (no need to lock the buffer)
+  char etag[40] = {0};
+  if (subJson == json_target::effects || subJson == json_target::palettes) {
+    metadataEtag(etag, subJson == json_target::effects ? 'e' : 'p');
+    if (handleIfNoneMatch(request, etag)) return;
+  }
+
   if (!requestJSONBufferLock(JSON_LOCK_SERVEJSON)) {
     request->deferResponse();    
     return;
@@ -1427,6 +1835,7 @@ void serveJson(AsyncWebServerRequest* request)
 
   [[maybe_unused]] size_t len = response->setLength();
   DEBUG_PRINTF_P(PSTR("JSON content length: %u\n"), len);
+  if (etag[0]) setContentCacheHeaders(response, etag);
 
   request->send(response);
 }
@@ -1474,7 +1883,11 @@ bool serveLiveLeds(AsyncWebServerRequest* request, uint32_t wsClient)
     r = scale8(qadd8(w, r), strip.getBrightness()); //R, add white channel to RGB channels as a simple RGBW -> RGB map
     g = scale8(qadd8(w, g), strip.getBrightness()); //G
     b = scale8(qadd8(w, b), strip.getBrightness()); //B
-    buf += sprintf_P(buf, PSTR("\"%06X\","), RGBW32(r,g,b,0));
+    const uint32_t rgb = RGBW32(r,g,b,0);
+    *buf++ = '"';
+    for (int shift = 20; shift >= 0; shift -= 4) *buf++ = "0123456789ABCDEF"[(rgb >> shift) & 0xF]; // faster than sprintf_P per LED
+    *buf++ = '"';
+    *buf++ = ',';
   }
   buf--;  // remove last comma
   buf += sprintf_P(buf, PSTR("],\"n\":%d"), n);
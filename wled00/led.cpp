@@ -139,7 +139,7 @@ void stateUpdated(byte callMode) {
 
 
 void updateInterfaces(uint8_t callMode) {
-  if (!interfaceUpdateCallMode || millis() - lastInterfaceUpdate < INTERFACE_UPDATE_COOLDOWN) return;
+  if (!interfaceUpdateCallMode || millis() - lastInterfaceUpdate < interfaceUpdateCooldown) return;
 
   sendDataWs();
   lastInterfaceUpdate = millis();
@@ -18,6 +18,8 @@ static PlaylistEntry *playlistEntries = nullptr;
 static byte           playlistLen;               //number of playlist entries
 static int8_t         playlistIndex = -1;
 static uint32_t       playlistEntryDur = 0;      //duration of the current entry in milliseconds
+static int8_t         playlistPrefetched = -1;   //entry whose successor has already been prefetched
+static bool           playlistShuffled = false;  //next iteration has already been shuffled by look-ahead
 
 //values we need to keep about the parent playlist while inside sub-playlist
 static int16_t        parentPlaylistIndex = -1;
@@ -51,6 +53,8 @@ void unloadPlaylist() {
   playlistLen = 0;
   playlistOptions = 0;
   playlistEntryDur = 0;
+  playlistPrefetched = -1;
+  playlistShuffled = false;
   DEBUG_PRINTLN(F("Playlist unloaded."));
 }
 
@@ -148,12 +152,29 @@ int16_t loadPlaylist(JsonObject playlistObj, byte presetId) {
 }
 
 
+// preset that will be applied after the current entry (0 if none)
+// shuffles the next iteration in advance so look-ahead matches the order that will be played
+static byte nextPlaylistPreset() {
+  int next = (playlistIndex + 1) % playlistLen;
+  if (next) return playlistEntries[next].preset;
+  // playlist roll-over
+  if (playlistRepeat == 1) return parentPlaylistPresetId > 0 ? parentPlaylistPresetId : playlistEndPreset;
+  if ((playlistOptions & PL_OPTION_SHUFFLE) && !playlistShuffled && playlistIndex >= 0) {
+    shufflePlaylist();
+    playlistShuffled = true;
+  }
+  return playlistEntries[0].preset;
+}
+
+
 void handlePlaylist() {
   static unsigned long presetCycledTime = 0;
   if (currentPlaylist < 0 || playlistEntries == nullptr) return;
 
   if ((playlistEntryDur < UINT32_MAX && millis() - presetCycledTime > playlistEntryDur) || doAdvancePlaylist) {
-    presetCycledTime = millis();
+    // keep entries on schedule (no accumulated drift) unless we are more than an entry late
+    if (!doAdvancePlaylist && playlistEntryDur > 0 && millis() - presetCycledTime - playlistEntryDur < playlistEntryDur) presetCycledTime += playlistEntryDur;
+    else presetCycledTime = millis();
     if (bri == 0 || nightlightActive) return;
 
     ++playlistIndex %= playlistLen; // -1 at 1st run (limit to playlistLen)
@@ -170,7 +191,8 @@ void handlePlaylist() {
       }
       if (playlistRepeat > 1) playlistRepeat--; // decrease repeat count on each index reset if not an endless playlist
       // playlistRepeat == 0: endless loop
-      if (playlistOptions & PL_OPTION_SHUFFLE) shufflePlaylist(); // shuffle playlist and start over
+      if ((playlistOptions & PL_OPTION_SHUFFLE) && !playlistShuffled) shufflePlaylist(); // shuffle playlist and start over
+      playlistShuffled = false;
     }
 
     jsonTransitionOnce = true;
@@ -178,6 +200,9 @@ void handlePlaylist() {
     playlistEntryDur = playlistEntries[playlistIndex].dur > 0 ? playlistEntries[playlistIndex].dur : UINT32_MAX; // UINT32_MAX means infinite
     applyPresetFromPlaylist(playlistEntries[playlistIndex].preset);
     doAdvancePlaylist = false;
+  } else if (playlistPrefetched != playlistIndex && playlistIndex >= 0 && !jsonBufferLock && !strip.isUpdating()) {
+    // look-ahead: load and compile the next preset while idle so the switch does not wait for file system or JSON parsing
+    if (preparePreset(nextPlaylistPreset())) playlistPrefetched = playlistIndex;
   }
 }
 
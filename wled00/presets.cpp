@@ -16,6 +16,52 @@ static char *quickLoad = nullptr;
 static char *saveName = nullptr;
 static bool includeBri = true, segBounds = true, selectedOnly = false, playlistSave = false;;
 
+#ifdef ESP8266
+#define PRESET_SNAPSHOTS 2
+#else
+#define PRESET_SNAPSHOTS 6
+#endif
+
+// compiled presets (see compilePresetSnapshot()), least recently used is replaced
+// entries are dropped when their preset is saved/deleted or presets.json was uploaded (cacheInvalidate)
+static struct {
+  PresetSnapshot *snap;
+  unsigned long   used;
+  byte            preset;
+  byte            validate;
+} presetSnapshots[PRESET_SNAPSHOTS] = {};
+
+static void dropPresetSnapshot(byte index) {
+  for (auto &ps : presetSnapshots) if (ps.snap && (ps.preset == index || ps.validate != cacheInvalidate)) {
+    freePresetSnapshot(ps.snap);
+    ps.snap = nullptr;
+  }
+}
+
+static const PresetSnapshot *getPresetSnapshot(byte index) {
+  dropPresetSnapshot(0); // drop invalidated
+  for (auto &ps : presetSnapshots) if (ps.snap && ps.preset == index) {
+    ps.used = millis();
+    return ps.snap;
+  }
+  return nullptr;
+}
+
+static void storePresetSnapshot(byte index, PresetSnapshot *snap) {
+  if (!snap) return;
+  dropPresetSnapshot(index);
+  auto *slot = &presetSnapshots[0];
+  for (auto &ps : presetSnapshots) {
+    if (!ps.snap) { slot = &ps; break; }
+    if (millis() - ps.used > millis() - slot->used) slot = &ps;
+  }
+  freePresetSnapshot(slot->snap);
+  slot->snap     = snap;
+  slot->used     = millis();
+  slot->preset   = index;
+  slot->validate = cacheInvalidate;
+}
+
 static const char presets_json[] PROGMEM = "/presets.json";
 static const char tmp_json[] PROGMEM = "/tmp.json";
 const char *getPresetsFileName(bool persistent) {
@@ -70,7 +116,11 @@ static void doSaveState() {
   #endif
   writeObjectToFileUsingId(getPresetsFileName(persist), presetToSave, pDoc);
 
-  if (persist) presetsModifiedTime = toki.second(); //unix time
+  if (persist) {
+    presetsModifiedTime = toki.second(); //unix time
+    presetsVersion++;
+    dropPresetSnapshot(presetToSave); // compiled again when next loaded (saved "col" is not a JSON array)
+  }
   releaseJSONBufferLock();
   updateFSInfo();
 
@@ -124,6 +174,18 @@ bool applyPresetFromPlaylist(byte index)
   return true;
 }
 
+// load and compile a preset ahead of time (next playlist entry) so applying it needs neither file system nor JSON buffer
+// returns false if the preset could not be looked at yet (JSON buffer busy or preset operation pending)
+bool preparePreset(byte index)
+{
+  if (index == 0 || index > 250 || getPresetSnapshot(index)) return true;
+  if (presetToApply || presetToSave || !requestJSONBufferLock(JSON_LOCK_PRESET_PREFETCH)) return false;
+  DEBUG_PRINTF_P(PSTR("Prefetching preset: %u\n"), (unsigned)index);
+  if (readObjectFromFileUsingId(getPresetsFileName(), index, pDoc)) storePresetSnapshot(index, compilePresetSnapshot(pDoc->as<JsonObject>()));
+  releaseJSONBufferLock();
+  return true;
+}
+
 bool applyPreset(byte index, byte callMode)
 {
   unloadPlaylist(); // applying a preset unloads the playlist (#3827)
@@ -152,7 +214,27 @@ void handlePresets()
     return;
   }
 
-  if (presetToApply == 0 || !requestJSONBufferLock(JSON_LOCK_PRESET_LOAD)) return; // no preset waiting to apply, or JSON buffer is already allocated, return to loop until free
+  if (presetToApply == 0) return; // no preset waiting to apply
+
+  if (!requestJSONBufferLock(JSON_LOCK_PRESET_LOAD)) return; // JSON buffer is already allocated, return to loop until free
+
+  // compiled preset needs no file system access or JSON parsing (lock keeps segments consistent with JSON API)
+  const PresetSnapshot *snap = (presetToApply < 251) ? getPresetSnapshot(presetToApply) : nullptr;
+  if (snap) {
+    uint8_t tmpPreset = presetToApply;
+    uint8_t tmpMode   = callModeToApply;
+    presetToApply = 0; //clear request for preset
+    callModeToApply = 0;
+    DEBUG_PRINTF_P(PSTR("Applying preset snapshot: %u\n"), (unsigned)tmpPreset);
+    if (errorFlag == ERR_FS_PLOAD) errorFlag = ERR_NONE; // only reset errorflag if previous error was preset-related
+    applyPresetSnapshot(snap);
+    if (!errorFlag) currentPreset = tmpPreset;
+    releaseJSONBufferLock();
+    notify(tmpMode); // force UDP notification
+    stateUpdated(tmpMode);
+    updateInterfaces(tmpMode);
+    return;
+  }
 
   bool changePreset = false;
   uint8_t tmpPreset = presetToApply; // store temporary since deserializeState() may call applyPreset()
@@ -194,6 +276,7 @@ void handlePresets()
     changePreset = true;
   } else {
     if (!fdo["seg"].isNull() || !fdo["on"].isNull() || !fdo["bri"].isNull() || !fdo["nl"].isNull() || !fdo["ps"].isNull() || !fdo[F("playlist")].isNull()) changePreset = true;
+    if (presetErrFlag == ERR_NONE && tmpPreset < 251) storePresetSnapshot(tmpPreset, compilePresetSnapshot(fdo)); // before deserializeState() modifies fdo
     if (!(tmpMode == CALL_MODE_INIT || (tmpMode == CALL_MODE_BUTTON_PRESET && fdo["ps"].is<const char *>() && strchr(fdo["ps"].as<const char *>(),'~') != strrchr(fdo["ps"].as<const char *>(),'~'))))
       fdo.remove("ps"); // remove load request for presets to prevent recursive crash (if not called by boot preset or button which contains preset cycling string "1~5~")
     deserializeState(fdo, CALL_MODE_NO_NOTIFY, tmpPreset); // may change presetToApply by calling applyPreset()
@@ -262,6 +345,8 @@ void savePreset(byte index, const char* pname, JsonObject sObj)
         initPresetsFile(); // just in case if someone deleted presets.json using /edit
         writeObjectToFileUsingId(getPresetsFileName(), index, pDoc);
         presetsModifiedTime = toki.second(); //unix time
+        presetsVersion++;
+        dropPresetSnapshot(index);
         updateFSInfo();
       }
       p_free(saveName);
@@ -281,5 +366,7 @@ void deletePreset(byte index) {
   StaticJsonDocument<24> empty;
   writeObjectToFileUsingId(getPresetsFileName(), index, &empty);
   presetsModifiedTime = toki.second(); //unix time
+  presetsVersion++;
+  dropPresetSnapshot(index);
   updateFSInfo();
 }
\ No newline at end of file
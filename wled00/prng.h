@@ -1,3 +1,4 @@
+#pragma once
 #include "wled.h"
 
 // Simple and fast Pseudo-Random-Number-Generator for 16bit and 8bit random numbers
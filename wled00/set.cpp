@@ -208,6 +208,7 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     Bus::setCCTBlend(cctBlending);
     Bus::setGlobalAWMode(request->arg(F("AW")).toInt());
     strip.setTargetFps(request->arg(F("FR")).toInt());
+    psFrameBudget = request->arg(F("PSB")).toInt();
 
     bool busesChanged = false;
     for (int s = 0; s < 36; s++) { // theoretical limit is 36 : "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -227,6 +228,7 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       char ma[4] = "MA"; ma[2] = offset+s; ma[3] = 0; //max mA
       char ld[4] = "LD"; ld[2] = offset+s; ld[3] = 0; //driver type (RMT=0, I2S=1)
       char hs[4] = "HS"; hs[2] = offset+s; hs[3] = 0; //hostname (for network types, custom text for others)
+      char un[4] = "UN"; un[2] = offset+s; un[3] = 0; //E1.31 start universe (network E1.31 type)
       if (!request->hasArg(lp)) {
         DEBUG_PRINTF_P(PSTR("# of buses: %d\n"), s);
         break;
@@ -265,6 +267,9 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
           case 3 : freq = 10000; break;
           case 4 : freq = 20000; break;
         }
+      } else if (type == TYPE_NET_E131_RGB) {
+        freq = request->arg(un).toInt(); // start universe, 0 = e131OutUniverse
+        if (freq > 63999) freq = 0;
       } else {
         freq = 0;
       }
@@ -452,6 +457,13 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     receiveNotificationPalette = request->hasArg(F("RP"));
     receiveSegmentOptions = request->hasArg(F("SO"));
     receiveSegmentBounds = request->hasArg(F("SG"));
+    clockSyncEnabled = request->hasArg(F("CK"));
+    clockSyncFrames = request->hasArg(F("FL"));
+    fxDeterministic = request->hasArg(F("DF"));
+    t = request->arg(F("VL")).toInt();
+    if (t >= 0 && t <= MAX_LEDS) canvasLength = t;
+    t = request->arg(F("VO")).toInt();
+    if (t >= 0 && t < MAX_LEDS) canvasOffset = t;
     sendNotifications = request->hasArg(F("SS"));
     notifyDirect = request->hasArg(F("SD"));
     notifyButton = request->hasArg(F("SB"));
@@ -460,6 +472,9 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
 
     t = request->arg(F("UR")).toInt();
     if ((t>=0) && (t<30)) udpNumRetries = t;
+    notifyDelta = request->hasArg(F("SX"));
+    t = request->arg(F("WI")).toInt();
+    if (t >= 100 && t <= 10000) interfaceUpdateCooldown = t;
 
 
     nodeListEnabled = request->hasArg(F("NL"));
@@ -481,14 +496,30 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     if (t >= 0  && t <= 150) DMXSegmentSpacing = t;
     t = request->arg(F("PY")).toInt();
     if (t >= 0  && t <= 200) e131Priority = t;
+    t = request->arg(F("MM")).toInt();
+    if (t >= E131_MERGE_NONE && t <= E131_MERGE_LTP) e131MergeMode = t;
     t = request->arg(F("DM")).toInt();
     if (t >= DMX_MODE_DISABLED && t <= DMX_MODE_PRESET) DMXMode = t;
+    t = request->arg(F("EOU")).toInt();
+    if (t >= 1  && t <= 63999) e131OutUniverse = t;
+    t = request->arg(F("EOP")).toInt();
+    if (t >= 0  && t <= 200) e131OutPriority = t;
+    e131OutMulticast = request->hasArg(F("EOM"));
+    t = request->arg(F("EOS")).toInt();
+    if (t >= 0  && t <= 63999) e131OutSyncUniverse = t;
     t = request->arg(F("ET")).toInt();
     if (t > 99  && t <= 65000) realtimeTimeoutMs = t;
     arlsForceMaxBri = request->hasArg(F("FB"));
     arlsDisableGammaCorrection = request->hasArg(F("RG"));
     t = request->arg(F("WO")).toInt();
     if (t >= -255  && t <= 255) arlsOffset = t;
+    t = request->arg(F("JB")).toInt();
+    if (t >= 0  && t <= 3) realtimePlayoutFrames = t;
+    t = request->arg(F("RCW")).toInt();
+    if (t >= 0  && t <= 255) realtimeCanvasWidth = t;
+    t = request->arg(F("RCH")).toInt();
+    if (t >= 0  && t <= 255) realtimeCanvasHeight = t;
+    realtimeCanvasBilinear = request->hasArg(F("RCB"));
 
 #ifdef WLED_ENABLE_DMX_INPUT
     dmxInputTransmitPin = request->arg(F("IDMT")).toInt();
@@ -40,6 +40,7 @@ ESPAsyncE131::ESPAsyncE131(e131_packet_callback_function callback) {
 
 bool ESPAsyncE131::begin(bool multicast, uint16_t port, uint16_t universe, uint8_t n) {
   bool success = false;
+  _multicast = multicast;
 
   if (multicast) {
 		success = initMulticast(port, universe, n);
@@ -50,6 +51,16 @@ bool ESPAsyncE131::begin(bool multicast, uint16_t port, uint16_t universe, uint8
   return success;
 }
 
+void ESPAsyncE131::joinMulticastUniverse(uint16_t universe, bool join) {
+  if (!_multicast || !universe) return;
+  ip4_addr_t ifaddr;
+  ip4_addr_t multicast_addr;
+  ifaddr.addr = static_cast<uint32_t>(WLEDNetwork.localIP());
+  multicast_addr.addr = static_cast<uint32_t>(IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff)));
+  if (join) igmp_joingroup(&ifaddr, &multicast_addr);
+  else      igmp_leavegroup(&ifaddr, &multicast_addr);
+}
+
 /////////////////////////////////////////////////////////
 //
 // Private init() members
@@ -113,10 +124,13 @@ void ESPAsyncE131::parsePacket(AsyncUDPPacket _packet) {
   if (protocol == P_ARTNET) {
     if (memcmp(sbuff->art_id, ESPAsyncE131::ART_ID, sizeof(sbuff->art_id)))
       error = true; //not ART_ID = "Art-Net"
-    if (sbuff->art_opcode != ARTNET_OPCODE_OPDMX && sbuff->art_opcode != ARTNET_OPCODE_OPPOLL)
-      error = true; //not a DMX or poll packet
+    if (sbuff->art_opcode != ARTNET_OPCODE_OPDMX && sbuff->art_opcode != ARTNET_OPCODE_OPPOLL && sbuff->art_opcode != ARTNET_OPCODE_OPSYNC)
+      error = true; //not a DMX, poll or sync packet
   } else { //E1.31 error handling
-    if (pktLen < 126) { // need up to property_values[0] at offset 125
+    if (pktLen >= E131_SYNC_PACKET_LEN && htonl(sbuff->root_vector) == ESPAsyncE131::VECTOR_ROOT_EXTENDED) {
+      if (htonl(sbuff->frame_vector) != ESPAsyncE131::VECTOR_FRAME_SYNC)
+        error = true; // only synchronization packets are supported
+    } else if (pktLen < 126) { // need up to property_values[0] at offset 125
       error = true;
     } else {
       if (htonl(sbuff->root_vector) != ESPAsyncE131::VECTOR_ROOT)
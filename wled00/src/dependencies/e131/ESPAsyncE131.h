@@ -75,6 +75,7 @@ typedef struct ip_addr ip4_addr_t;
 #define DDP_ID_ALL      255  // all devices
 
 #define ARTNET_OPCODE_OPDMX 0x5000
+#define ARTNET_OPCODE_OPSYNC 0x5200
 #define ARTNET_OPCODE_OPPOLL 0x2000
 #define ARTNET_OPCODE_OPPOLLREPLY 0x2100
 
@@ -107,6 +108,11 @@ typedef struct ip_addr ip4_addr_t;
 #define E131_DMP_COUNT 123
 #define E131_DMP_DATA 125
 
+// E1.31 Synchronization Packet
+#define E131_SYNC_PACKET_LEN 49
+#define E131_SYNC_SEQ 44
+#define E131_SYNC_ADDRESS 45
+
 // E1.31 Packet Structure
 typedef union {
     struct { //E1.31 packet
@@ -227,8 +233,10 @@ class ESPAsyncE131 {
     static const uint32_t VECTOR_ROOT = 4;
     static const uint32_t VECTOR_FRAME = 2;
     static const uint8_t VECTOR_DMP = 2;
+    static const uint32_t VECTOR_FRAME_SYNC = 1;
 
     AsyncUDP        udp;        // AsyncUDP
+    bool            _multicast = false;
 
     // Internal Initializers
     bool initUnicast(uint16_t port);
@@ -240,10 +248,15 @@ class ESPAsyncE131 {
     e131_packet_callback_function _callback = nullptr;
 
  public:
+    static const uint32_t VECTOR_ROOT_EXTENDED = 8;
+
     ESPAsyncE131(e131_packet_callback_function callback);
 
     // Generic UDP listener, no physical or IP configuration
     bool begin(bool multicast, uint16_t port = E131_DEFAULT_PORT, uint16_t universe = 1, uint8_t n = 1);
+
+    // join/leave the multicast group of an additional universe (e.g. synchronization universe), no-op in unicast mode
+    void joinMulticastUniverse(uint16_t universe, bool join = true);
 };
 
 // Class to track e131 package priority
@@ -9,6 +9,19 @@
 static constexpr size_t WLEDPACKETSIZE = 41+(WS2812FX::getMaxSegments()*UDP_SEG_SIZE);  // make sure this is known at compile-time
 #define UDP_IN_MAXSIZE 1472
 #define PRESUMED_NETWORK_DELAY 3 //how many ms could it take on avg to reach the receiver? This will be added to transmitted times
+#define CLOCK_SYNC_SAMPLES     8        //exchanges kept, the one with the shortest round trip is used
+#define CLOCK_SYNC_FAST        250      //ms between requests until enough samples were collected
+#define CLOCK_SYNC_INTERVAL    2000     //ms between requests when synchronized
+#define CLOCK_SYNC_APPLY       100      //ms between timebase updates
+#define CLOCK_SYNC_TIMEOUT     30000    //ms without valid exchange until falling back to notification timebase
+#define CLOCK_SYNC_MAX_RTT     50000    //us, exchanges with longer round trip are discarded
+#define CLOCK_SYNC_STEP        20       //ms, larger offset change means the master clock was reset
+#define CLOCK_SYNC_DRIFT_SPAN  10000000 //us between offsets used to estimate drift
+#define CLOCK_SYNC_MAX_DRIFT   500.0f   //ppm
+#define SYNC_MAX_PEERS         16       //receivers acknowledging v13 notifications
+#define SYNC_PEER_MISSES       8        //unacknowledged notifications until a receiver is forgotten
+#define SYNC_MAX_RETRIES       3        //follow-ups until all receivers acknowledged (without legacy receivers)
+#define SYNC_FULL_INTERVAL     8        //every n-th notification is a full packet (receivers unknown to the node list)
 
 typedef struct PartialEspNowPacket {
   uint8_t magic;
@@ -17,6 +30,269 @@ typedef struct PartialEspNowPacket {
   uint8_t data[247];
 } partial_packet_t;
 
+/*
+ * Effect clock sync: a node that receives notifications measures the offset of its clock against the
+ * effect clock (millis() + strip.timebase) of the sender with NTP-style two-way timestamps:
+ * offset = ((t2-t1) + (t3-t4)) / 2, round trip = (t4-t1) - (t3-t2)
+ * Packets are stamped when read from the socket (t2, t4). Of the last CLOCK_SYNC_SAMPLES exchanges the one with
+ * the shortest round trip (least queuing) is used, extrapolated with the measured drift between both clocks.
+ */
+typedef struct ClockSample {
+  int64_t  offset; // master effect clock - local clock (us)
+  uint64_t at;     // local time of measurement (us)
+  uint32_t rtt;    // us
+} clock_sample_t;
+
+static clock_sample_t clockSamples[CLOCK_SYNC_SAMPLES];
+static uint8_t        clockSampleCount = 0;
+static uint8_t        clockSampleIdx   = 0;
+static uint8_t        clockRequests    = 0;
+static uint32_t       clockMasterIP    = 0;       // sender of last notification, 0 if we are the master
+static uint64_t       clockRequestT1   = 0;       // send time of outstanding request
+static unsigned long  clockRequestTime = 0;
+static unsigned long  clockApplyTime   = 0;
+static unsigned long  clockSampleTime  = 0;       // millis() of last valid exchange
+static float          clockDrift       = 0.0f;    // ppm
+static int64_t        clockRefOffset   = 0;       // offset estimate used as drift reference
+static uint64_t       clockRefAt       = 0;
+
+static inline uint64_t clockMicros() {
+#ifdef ARDUINO_ARCH_ESP32
+  return esp_timer_get_time();
+#else
+  return micros64();
+#endif
+}
+
+// effect clock (millis() + strip.timebase) in us, both millis() and clockMicros() use the same hardware timer
+static inline int64_t effectClock(uint64_t us) { return (int64_t)us + (int64_t)(int32_t)strip.timebase * 1000; }
+
+static inline void putClock(uint8_t *p, uint64_t v) { for (int i = 7; i >= 0; i--, v >>= 8) p[i] = v & 0xFF; }
+static inline uint64_t getClock(const uint8_t *p) { uint64_t v = 0; for (int i = 0; i < 8; i++) v = (v << 8) | p[i]; return v; }
+
+// appends receive timestamp to clock sync packets (buffer must have room for 8 more bytes)
+static inline size_t stampClockSync(uint8_t *data, size_t len, uint64_t rxTime) {
+  if (len < 2 || len > CLOCK_SYNC_RESP_LEN || data[0] != CLOCK_SYNC_PACKET) return len;
+  putClock(data + len, rxTime);
+  return len + 8;
+}
+
+static inline bool clockSyncLocked() { return clockSyncEnabled && clockSampleCount > 0; }
+
+static void clockSyncReset(uint32_t master) {
+  clockMasterIP    = master;
+  clockSampleCount = 0;
+  clockRequests    = 0;
+  clockRefAt       = 0;
+  clockRequestTime = millis() - CLOCK_SYNC_INTERVAL; // request immediately
+  clockSyncRTT     = 0;
+}
+
+// sender of a notification carrying a timebase becomes the clock master
+static void followClockMaster(IPAddress ip) {
+  if (!clockSyncEnabled || millis() - notificationSentTime < 1000) return; // notification will be ignored
+  if (uint32_t(ip) != clockMasterIP) clockSyncReset(ip);
+}
+
+// estimated master effect clock - local clock at local time us
+static int64_t clockOffsetAt(uint64_t us) {
+  const clock_sample_t *best = &clockSamples[0];
+  for (unsigned i = 1; i < clockSampleCount; i++) if (clockSamples[i].rtt < best->rtt) best = &clockSamples[i];
+  clockSyncRTT = best->rtt > 65535 ? 65535 : best->rtt;
+  return best->offset + (int64_t)(clockDrift * (float)(int64_t)(us - best->at) * 1e-6f);
+}
+
+static void sendClockRequest() {
+  uint8_t req[CLOCK_SYNC_REQ_LEN];
+  req[0] = CLOCK_SYNC_PACKET;
+  req[1] = CLOCK_SYNC_REQUEST;
+  lockUdpSockets();
+  notifierUdp.beginPacket(IPAddress(clockMasterIP), udpPort);
+  clockRequestT1 = clockMicros();
+  putClock(req + 2, clockRequestT1);
+  notifierUdp.write(req, sizeof(req));
+  notifierUdp.endPacket();
+  unlockUdpSockets();
+  if (clockRequests < 255) clockRequests++;
+}
+
+static void handleClockSyncPacket(const uint8_t *data, size_t len, IPAddress remoteIP) {
+  if (data[1] == CLOCK_SYNC_REQUEST && len == CLOCK_SYNC_REQ_LEN + 8) {
+    uint8_t resp[CLOCK_SYNC_RESP_LEN];
+    resp[0] = CLOCK_SYNC_PACKET;
+    resp[1] = CLOCK_SYNC_RESPONSE;
+    memcpy(resp + 2, data + 2, 8);                                 // t1
+    putClock(resp + 10, effectClock(getClock(data + CLOCK_SYNC_REQ_LEN))); // t2
+    lockUdpSockets();
+    notifierUdp.beginPacket(remoteIP, udpPort);
+    putClock(resp + 18, effectClock(clockMicros()));               // t3, as late as possible
+    notifierUdp.write(resp, sizeof(resp));
+    notifierUdp.endPacket();
+    unlockUdpSockets();
+    return;
+  }
+  if (data[1] != CLOCK_SYNC_RESPONSE || len != CLOCK_SYNC_RESP_LEN + 8) return;
+  if (!clockSyncEnabled || uint32_t(remoteIP) != clockMasterIP) return;
+  const uint64_t t1 = getClock(data + 2);
+  if (t1 != clockRequestT1) return; // reply to an earlier request
+  const int64_t  t2 = getClock(data + 10);
+  const int64_t  t3 = getClock(data + 18);
+  const uint64_t t4 = getClock(data + CLOCK_SYNC_RESP_LEN);
+  const int64_t  rtt = (int64_t)(t4 - t1) - (t3 - t2);
+  if (rtt < 0 || rtt > CLOCK_SYNC_MAX_RTT) return;
+  const int64_t  offset = ((t2 - (int64_t)t1) + (t3 - (int64_t)t4)) / 2;
+
+  if (clockSyncLocked()) {
+    int64_t diff = offset - clockOffsetAt(t4);
+    if (diff > CLOCK_SYNC_STEP*1000LL || diff < -CLOCK_SYNC_STEP*1000LL) clockSyncReset(clockMasterIP); // master timebase was reset
+  }
+  clock_sample_t &sample = clockSamples[clockSampleIdx];
+  sample.offset = offset;
+  sample.at     = t4;
+  sample.rtt    = rtt;
+  clockSampleIdx = (clockSampleIdx + 1) % CLOCK_SYNC_SAMPLES;
+  if (clockSampleCount < CLOCK_SYNC_SAMPLES) clockSampleCount++;
+  clockSampleTime = millis();
+
+  // drift: change of offset estimate over time, smoothed
+  const int64_t estimate = clockOffsetAt(t4);
+  if (clockRefAt == 0) {
+    clockRefOffset = estimate;
+    clockRefAt     = t4;
+  } else if (t4 - clockRefAt >= CLOCK_SYNC_DRIFT_SPAN) {
+    float ppm = (float)(estimate - clockRefOffset) * 1e6f / (float)(t4 - clockRefAt);
+    clockDrift += (constrain(ppm, -CLOCK_SYNC_MAX_DRIFT, CLOCK_SYNC_MAX_DRIFT) - clockDrift) * 0.25f;
+    clockSyncDrift = clockDrift;
+    clockRefOffset = estimate;
+    clockRefAt     = t4;
+  }
+  DEBUG_PRINTF_P(PSTR("Clock sync: offset %dus, rtt %uus, drift %dppm\n"), (int)(offset % 1000000), (unsigned)rtt, (int)clockDrift);
+}
+
+// polls the master and derives strip.timebase from the estimated offset
+static void handleClockSync() {
+  if (!clockSyncEnabled || !clockMasterIP) return;
+  const unsigned long now = millis();
+  if (clockSyncLocked() && now - clockSampleTime > CLOCK_SYNC_TIMEOUT) clockSyncReset(clockMasterIP); // master gone or not supporting clock sync
+  bool fast = clockSampleCount < CLOCK_SYNC_SAMPLES/2 && clockRequests < 4*CLOCK_SYNC_SAMPLES;
+  if (now - clockRequestTime >= (fast ? CLOCK_SYNC_FAST : CLOCK_SYNC_INTERVAL)) {
+    clockRequestTime = now;
+    sendClockRequest();
+  }
+  if (!clockSyncLocked() || now - clockApplyTime < CLOCK_SYNC_APPLY) return;
+  clockApplyTime = now;
+  const uint64_t us = clockMicros();
+  int64_t master = (int64_t)us + clockOffsetAt(us);
+  master = master >= 0 ? master / 1000 : -((999 - master) / 1000); // floor to ms
+  strip.timebase = (unsigned long)master - (unsigned long)(us / 1000);
+}
+
+/*
+ * Notifier v13: receivers acknowledge full packets (trailing sequence number), the sender then sends only byte runs
+ * that changed against the last packet all known receivers acknowledged. Missing acknowledgements are answered with a
+ * full follow-up packet. Full packets and configured retransmits are used while receivers not supporting v13 may be present.
+ */
+typedef struct SyncPeer {
+  uint32_t ip;
+  uint8_t  seq;    // last acknowledged sequence number
+  uint8_t  missed; // notifications sent since last acknowledgement
+} sync_peer_t;
+
+static sync_peer_t syncPeers[SYNC_MAX_PEERS];
+static uint8_t     syncPeerCount = 0;
+static uint8_t     syncSeq       = 0;
+static bool        syncLegacy    = true;    // full packets and udpNumRetries retransmits
+static uint8_t    *syncLast      = nullptr; // last sent packet, followed by delta packet buffer
+static size_t      syncLastLen   = 0;
+
+static int findSyncPeer(uint32_t ip) {
+  for (unsigned i = 0; i < syncPeerCount; i++) if (syncPeers[i].ip == ip) return i;
+  return -1;
+}
+
+static void handleSyncAck(IPAddress ip, uint8_t seq) {
+  int i = findSyncPeer(uint32_t(ip));
+  if (i < 0) {
+    if (syncPeerCount >= SYNC_MAX_PEERS) return; // such receiver will not get a delta, but will not block others
+    i = syncPeerCount++;
+    syncPeers[i].ip = uint32_t(ip);
+  }
+  syncPeers[i].seq    = seq;
+  syncPeers[i].missed = 0;
+}
+
+static bool syncPeersAcked() {
+  for (unsigned i = 0; i < syncPeerCount; i++) if (syncPeers[i].seq != syncSeq) return false;
+  return true;
+}
+
+// receivers without v13 support need full packets
+// an acknowledgement is the only proof of v13 support: every node in the node list that did not acknowledge is
+// treated as legacy (whatever its build), without node list every receiver is assumed to be legacy
+static bool hasLegacySyncReceivers() {
+  if (!notifyDelta || syncPeerCount == 0 || !nodeListEnabled || Nodes.empty()) return true;
+  for (const auto &node : Nodes) {
+    if (findSyncPeer(uint32_t(node.second.ip)) < 0) return true;
+  }
+  return false;
+}
+
+// follow-up notifications: configured retransmits with legacy receivers, otherwise until all receivers acknowledged
+static unsigned syncRetries() {
+  if (syncLegacy) return udpNumRetries;
+  return syncPeersAcked() ? 0 : SYNC_MAX_RETRIES;
+}
+
+// encodes bytes changed against the last sent packet into out, returns 0 if not smaller than the full packet
+static size_t encodeSyncDelta(const uint8_t *udpOut, size_t len, uint8_t *out) {
+  out[0] = 0;
+  out[1] = NOTIFIER_DELTA;
+  out[2] = syncSeq + 1;
+  out[3] = syncSeq;
+  out[4] = len >> 8;
+  out[5] = len & 0xFF;
+  size_t pos = 6;
+  for (size_t i = 0; i < len;) {
+    if (udpOut[i] == syncLast[i]) { i++; continue; }
+    size_t end = i + 1; // extend run over up to 3 unchanged bytes (cheaper than a new run header)
+    for (size_t j = i + 1; j < len && j - i < 255 && j - end <= 3; j++) if (udpOut[j] != syncLast[j]) end = j + 1;
+    const size_t runLen = end - i;
+    if (pos + 3 + runLen >= len) return 0;
+    out[pos++] = i >> 8;
+    out[pos++] = i & 0xFF;
+    out[pos++] = runLen;
+    memcpy(out + pos, udpOut + i, runLen);
+    pos += runLen;
+    i = end;
+  }
+  return pos;
+}
+
+// sends notification of len bytes (udpOut must have room for trailing sequence number)
+static void sendSyncPacket(uint8_t *udpOut, size_t len, IPAddress ip, bool followUp) {
+  if (!syncLast) syncLast = static_cast<uint8_t*>(d_malloc(2 * WLEDPACKETSIZE));
+  for (int i = syncPeerCount - 1; i >= 0; i--) {
+    if (syncPeers[i].seq == syncSeq || ++syncPeers[i].missed <= SYNC_PEER_MISSES) continue;
+    syncPeers[i] = syncPeers[--syncPeerCount]; // receiver gone
+  }
+  syncLegacy = hasLegacySyncReceivers();
+  size_t deltaLen = 0;
+  if (syncLast && !syncLegacy && !followUp && len == syncLastLen && syncPeersAcked() && (syncSeq + 1) % SYNC_FULL_INTERVAL)
+    deltaLen = encodeSyncDelta(udpOut, len, syncLast + WLEDPACKETSIZE);
+  udpOut[len] = ++syncSeq; // ignored by older receivers
+  lockUdpSockets();
+  notifierUdp.beginPacket(ip, udpPort);
+  if (deltaLen) notifierUdp.write(syncLast + WLEDPACKETSIZE, deltaLen);
+  else          notifierUdp.write(udpOut, len + 1);
+  notifierUdp.endPacket();
+  unlockUdpSockets();
+  DEBUG_PRINTF_P(PSTR("UDP sent %s packet: %u\n"), deltaLen ? "delta" : "full", (unsigned)(deltaLen ? deltaLen : len + 1));
+  if (syncLast) {
+    memcpy(syncLast, udpOut, len);
+    syncLastLen = len;
+  }
+}
+
 void notify(byte callMode, bool followUp)
 {
 #ifndef WLED_DISABLE_ESPNOW
@@ -37,7 +313,7 @@ void notify(byte callMode, bool followUp)
     case CALL_MODE_ALEXA:         if (!notifyAlexa)  return; break;
     default: return;
   }
-  byte udpOut[WLEDPACKETSIZE];  //TODO: optimize size to use only active segments
+  byte udpOut[WLEDPACKETSIZE+1]; // +1 for v13 sequence number
   Segment& mainseg = strip.getMainSegment();
   udpOut[0] = 0; //0: wled notifier protocol 1: WARLS protocol
   udpOut[1] = callMode;
@@ -56,8 +332,8 @@ void notify(byte callMode, bool followUp)
   //3: supports FX intensity, 24 byte packet 4: supports transitionDelay 5: sup palette
   //6: supports timebase syncing, 29 byte packet 7: supports tertiary color 8: supports sys time sync, 36 byte packet
   //9: supports sync groups, 37 byte packet 10: supports CCT, 39 byte packet 11: per segment options, variable packet length (40+WS2812FX::getMaxSegments()*3)
-  //12: enhanced effect sliders, 2D & mapping options
-  udpOut[11] = 12;
+  //12: enhanced effect sliders, 2D & mapping options 13: packet length of active segments + sequence number, delta packets
+  udpOut[11] = 13;
   col = mainseg.colors[1];
   udpOut[12] = R(col);
   udpOut[13] = G(col);
@@ -194,10 +470,9 @@ void notify(byte callMode, bool followUp)
   {
     DEBUG_PRINTLN(F("UDP sending packet."));
     IPAddress broadcastIp = ~uint32_t(WLEDNetwork.subnetMask()) | uint32_t(WLEDNetwork.gatewayIP());
-    notifierUdp.beginPacket(broadcastIp, udpPort);
-    notifierUdp.write(udpOut, WLEDPACKETSIZE); // TODO: add actual used buffer size
-    notifierUdp.endPacket();
+    sendSyncPacket(udpOut, 41 + s*UDP_SEG_SIZE, broadcastIp, followUp);
   }
+  if (!followUp) clockSyncReset(0); // our effect clock is the reference now
   notificationSentCallMode = callMode;
   notificationSentTime = millis();
   notificationCount = followUp ? notificationCount + 1 : 0;
@@ -370,8 +645,12 @@ static void parseNotifyPacket(const uint8_t *udpIn) {
     uint32_t t = (udpIn[25] << 24) | (udpIn[26] << 16) | (udpIn[27] << 8) | (udpIn[28]);
     t += PRESUMED_NETWORK_DELAY; //adjust trivially for network delay
     t -= millis();
-    strip.timebase = t;
-    timebaseUpdated = true;
+    int32_t diff = t - strip.timebase;
+    if (!clockSyncLocked() || abs(diff) > CLOCK_SYNC_STEP) { // keep measured clock offset unless the sender restarted its effects
+      if (clockSyncLocked()) clockSyncReset(clockMasterIP);
+      strip.timebase = t;
+      timebaseUpdated = true;
+    }
   }
 
   //adjust system time, but only if sender is more accurate than self
@@ -404,6 +683,54 @@ static void parseNotifyPacket(const uint8_t *udpIn) {
   stateUpdated(CALL_MODE_NOTIFICATION);
 }
 
+static uint8_t *syncImage    = nullptr; // last notification received from syncImageIP (base for delta packets)
+static size_t   syncImageLen = 0;
+static uint8_t  syncImageSeq = 0;
+static uint32_t syncImageIP  = 0;
+
+static void sendSyncAck(IPAddress ip, uint8_t seq) {
+  const uint8_t ack[3] = {0, NOTIFIER_ACK, seq};
+  lockUdpSockets();
+  notifierUdp.beginPacket(ip, udpPort);
+  notifierUdp.write(ack, sizeof(ack));
+  notifierUdp.endPacket();
+  unlockUdpSockets();
+}
+
+// full notifications (v13: acknowledged, kept as base) and delta packets (applied to base)
+static void handleNotifyPacket(const uint8_t *udpIn, size_t packetSize, IPAddress remoteIP) {
+  if (udpIn[1] == NOTIFIER_DELTA) {
+    // without matching base the sender will not get an acknowledgement and send a full packet
+    if (packetSize < 6 || !syncImage || uint32_t(remoteIP) != syncImageIP || udpIn[3] != syncImageSeq) return;
+    if (((udpIn[4] << 8) | udpIn[5]) != syncImageLen) return;
+    for (size_t pos = 6; pos < packetSize;) { // validate all runs before modifying base
+      if (pos + 3 > packetSize) return;
+      size_t ofs = (udpIn[pos] << 8) | udpIn[pos+1], len = udpIn[pos+2];
+      if (ofs + len > syncImageLen || pos + 3 + len > packetSize) return;
+      pos += 3 + len;
+    }
+    for (size_t pos = 6; pos < packetSize; pos += 3 + udpIn[pos+2]) {
+      memcpy(syncImage + ((udpIn[pos] << 8) | udpIn[pos+1]), udpIn + pos + 3, udpIn[pos+2]);
+    }
+    syncImageSeq = udpIn[2];
+    sendSyncAck(remoteIP, syncImageSeq);
+    parseNotifyPacket(syncImage);
+    return;
+  }
+  const size_t len = packetSize > 40 ? 41 + udpIn[39] * udpIn[40] : 0;
+  if (len && udpIn[11] > 12 && packetSize == len + 1 && len <= WLEDPACKETSIZE) {
+    if (!syncImage) syncImage = static_cast<uint8_t*>(d_malloc(WLEDPACKETSIZE));
+    if (syncImage) {
+      memcpy(syncImage, udpIn, len);
+      syncImageLen = len;
+      syncImageSeq = udpIn[len];
+      syncImageIP  = uint32_t(remoteIP);
+      sendSyncAck(remoteIP, syncImageSeq);
+    }
+  }
+  parseNotifyPacket(udpIn);
+}
+
 // realtimeLock() is called from UDP notifications, JSON API or serial Ada
 void realtimeLock(uint32_t timeoutMs, byte md)
 {
@@ -455,23 +782,136 @@ void exitRealtime() {
 
 #define TMP2NET_OUT_PORT 65442
 
-static void sendTPM2Ack() {
-  notifierUdp.beginPacket(notifierUdp.remoteIP(), TMP2NET_OUT_PORT);
+static void sendTPM2Ack(IPAddress remoteIP) {
+  lockUdpSockets();
+  notifierUdp.beginPacket(remoteIP, TMP2NET_OUT_PORT);
   uint8_t response_ack = 0xac;
   notifierUdp.write(&response_ack, 1);
   notifierUdp.endPacket();
+  unlockUdpSockets();
+}
+
+
+#define UDP_SRC_NOTIFY 0 // notifierUdp (WLED sync, UDP realtime, TPM2.NET, API)
+#define UDP_SRC_SUPP   1 // notifier2Udp (node list)
+#define UDP_SRC_RGB    2 // rgbUdp (Hyperion raw RGB)
+
+// packets per second statistics, updated once per second
+static void updateUdpRxRate() {
+  static unsigned long lastRateUpdate = 0;
+  static uint32_t lastRxPackets = 0;
+  unsigned long now = millis();
+  if (now - lastRateUpdate < 1000) return;
+  udpRxRate = ((udpRxPackets - lastRxPackets) * 1000) / (now - lastRateUpdate);
+  lastRxPackets = udpRxPackets;
+  lastRateUpdate = now;
 }
 
+static void handleUdpPacket(uint8_t *udpIn, size_t packetSize, uint8_t source, IPAddress remoteIP);
+
+#ifdef ARDUINO_ARCH_ESP32
+/*
+ * On ESP32 the notifier, realtime and Hyperion sockets are read by a dedicated task so packets are not lost
+ * while the main loop is busy. Packets are passed to the main loop through a single-producer/single-consumer ring;
+ * full frames (Hyperion, DRGB, DRGBW) that are superseded by a newer full frame in the ring are skipped unseen.
+ * Socket sends and (re)starts from other tasks must hold lockUdpSockets(), as WiFiUDP keeps the remote address in the object.
+ */
+#define UDP_RX_QUEUE_LEN 4
+
+typedef struct UdpRxSlot {
+  uint16_t len;
+  uint8_t  source;
+  uint32_t remoteIP;
+  uint8_t  data[UDP_IN_MAXSIZE+1]; // +1 for string terminator (API over UDP)
+} udp_rx_slot_t;
+
+static udp_rx_slot_t    *udpRxQueue     = nullptr;
+static volatile uint8_t  udpRxHead      = 0;        // written by receive task (producer)
+static volatile uint8_t  udpRxTail      = 0;        // written by main loop (consumer)
+static TaskHandle_t      udpRxTask      = nullptr;
+static SemaphoreHandle_t udpSocketMutex = nullptr;
+static bool              udpRxFailed    = false;    // do not retry task creation
+
+void lockUdpSockets()   { if (udpSocketMutex) xSemaphoreTake(udpSocketMutex, portMAX_DELAY); }
+void unlockUdpSockets() { if (udpSocketMutex) xSemaphoreGive(udpSocketMutex); }
+
+// returns false if no packet was pending
+static bool receiveToQueue(WiFiUDP &udp, uint8_t source) {
+  size_t packetSize = udp.parsePacket();
+  if (!packetSize) return false;
+  const uint64_t rxTime = clockMicros();
+  udpRxPackets++;
+  if (packetSize > UDP_IN_MAXSIZE) return true; // discarded by next parsePacket()
+  const unsigned head = udpRxHead;
+  const unsigned next = (head + 1) % UDP_RX_QUEUE_LEN;
+  if (next == udpRxTail) { udpRxDropped++; return true; } // main loop congested, drop packet
+  udp_rx_slot_t &slot = udpRxQueue[head];
+  slot.len = stampClockSync(slot.data, udp.read(slot.data, packetSize), rxTime);
+  slot.source = source;
+  slot.remoteIP = udp.remoteIP();
+  udpRxHead = next; // publish packet
+  return true;
+}
+
+static void udpRxTaskFn(void *) {
+  for (;;) {
+    bool received = true;
+    for (unsigned n = 0; received && n < UDP_RX_QUEUE_LEN; n++) {
+      received = false;
+      xSemaphoreTake(udpSocketMutex, portMAX_DELAY);
+      if (udpConnected)    received |= receiveToQueue(notifierUdp, UDP_SRC_NOTIFY);
+      if (udp2Connected)   received |= receiveToQueue(notifier2Udp, UDP_SRC_SUPP);
+      if (udpRgbConnected) received |= receiveToQueue(rgbUdp, UDP_SRC_RGB);
+      xSemaphoreGive(udpSocketMutex);
+    }
+    delay(1); // let lower priority tasks on this core run
+  }
+}
+
+static void startUdpRxTask() {
+  if (udpRxFailed) return;
+  if (!udpRxQueue) udpRxQueue = static_cast<udp_rx_slot_t*>(p_malloc(UDP_RX_QUEUE_LEN * sizeof(udp_rx_slot_t)));
+  if (!udpSocketMutex) udpSocketMutex = xSemaphoreCreateMutex();
+  if (udpRxQueue && udpSocketMutex) xTaskCreateUniversal(udpRxTaskFn, "UdpRx", 4096, nullptr, 2, &udpRxTask, 0);
+  if (!udpRxTask) {
+    DEBUG_PRINTLN(F("UDP receive task not started, polling sockets."));
+    udpRxFailed = true;
+  }
+}
+
+static inline bool isUdpRealtimeFrame(const udp_rx_slot_t &slot) {
+  if (!receiveDirect) return false;
+  if (slot.source == UDP_SRC_RGB) return true;
+  return slot.source == UDP_SRC_NOTIFY && slot.len > 2 && (slot.data[0] == 2 || slot.data[0] == 3) && slot.data[1]; // DRGB/DRGBW
+}
+
+// processes packets queued by the receive task, skipping full frames that were superseded by a newer one
+static void handleUdpRxQueue() {
+  const unsigned head = udpRxHead;
+  unsigned tail = udpRxTail;
+  if (head == tail) return;
+  int lastFrame = -1;
+  for (unsigned i = tail; i != head; i = (i + 1) % UDP_RX_QUEUE_LEN)
+    if (isUdpRealtimeFrame(udpRxQueue[i])) lastFrame = i;
+  while (tail != head) {
+    udp_rx_slot_t &slot = udpRxQueue[tail];
+    if (lastFrame >= 0 && (int)tail != lastFrame && isUdpRealtimeFrame(slot)) udpRxSkipped++;
+    else handleUdpPacket(slot.data, slot.len, slot.source, IPAddress(slot.remoteIP));
+    tail = (tail + 1) % UDP_RX_QUEUE_LEN;
+    udpRxTail = tail; // release slot
+  }
+}
+#endif
 
 void handleNotifications()
 {
-  IPAddress localIP;
-
-  //send second notification if enabled
-  if(udpConnected && (notificationCount < udpNumRetries) && ((millis()-notificationSentTime) > 250)){
+  //send second notification if enabled or not acknowledged
+  if(udpConnected && (notificationCount < syncRetries()) && ((millis()-notificationSentTime) > 250)){
     notify(notificationSentCallMode,true);
   }
 
+  handleE131FrameTimeout();
+  handleRealtimePlayout();
   if (e131NewData && millis() - strip.getLastShow() > 15)
   {
     e131NewData = false;
@@ -485,48 +925,68 @@ void handleNotifications()
   //receive UDP notifications
   if (!udpConnected) return;
 
-  bool isSupp = false;
+  updateUdpRxRate();
+  handleClockSync();
+
+#ifdef ARDUINO_ARCH_ESP32
+  if (!udpRxTask) startUdpRxTask();
+  if (udpRxTask) { // sockets are read by the receive task
+    handleUdpRxQueue();
+    return;
+  }
+#endif
+
+  uint8_t source = UDP_SRC_NOTIFY;
+  WiFiUDP *udp = &notifierUdp;
   size_t packetSize = notifierUdp.parsePacket();
   if (!packetSize && udp2Connected) {
     packetSize = notifier2Udp.parsePacket();
-    isSupp = true;
+    source = UDP_SRC_SUPP;
+    udp = &notifier2Udp;
   }
-
-  //hyperion / raw RGB
   if (!packetSize && udpRgbConnected) {
     packetSize = rgbUdp.parsePacket();
-    if (packetSize) {
-      if (!receiveDirect) return;
-      if (packetSize > UDP_IN_MAXSIZE || packetSize < 3) return;  // packetSize must not exceed buffersize (UDP_IN_MAXSIZE)
-      realtimeIP = rgbUdp.remoteIP();
-      DEBUG_PRINTLN(rgbUdp.remoteIP());
-      uint8_t lbuf[packetSize];
-      rgbUdp.read(lbuf, packetSize);
-      realtimeLock(realtimeTimeoutMs, REALTIME_MODE_HYPERION);
-      if (realtimeOverride) return;
-      unsigned totalLen = strip.getLengthTotal();
-      for (size_t i = 0, id = 0; i < packetSize -2 && id < totalLen; i += 3, id++) {
-        setRealtimePixel(id, lbuf[i], lbuf[i+1], lbuf[i+2], 0);
-      }
-      if (useMainSegmentOnly) strip.trigger();
-      else                    strip.show();
-      return;
+    source = UDP_SRC_RGB;
+    udp = &rgbUdp;
+  }
+  if (!packetSize || packetSize > UDP_IN_MAXSIZE) return; // packetSize must not exceed buffersize (UDP_IN_MAXSIZE)
+  const uint64_t rxTime = clockMicros();
+  udpRxPackets++;
+
+  uint8_t udpIn[packetSize +9]; // +1 for string terminator (API over UDP), +8 for clock sync receive timestamp
+  size_t len = stampClockSync(udpIn, udp->read(udpIn, packetSize), rxTime);
+  handleUdpPacket(udpIn, len, source, udp->remoteIP());
+}
+
+// processes one received packet, source is the socket it arrived on (UDP_SRC_*)
+static void handleUdpPacket(uint8_t *udpIn, size_t packetSize, uint8_t source, IPAddress remoteIP)
+{
+  bool isSupp = source == UDP_SRC_SUPP;
+
+  //hyperion / raw RGB
+  if (source == UDP_SRC_RGB) {
+    if (!receiveDirect) return;
+    if (packetSize < 3) return;
+    realtimeIP = remoteIP;
+    DEBUG_PRINTLN(remoteIP);
+    realtimeLock(realtimeTimeoutMs, REALTIME_MODE_HYPERION);
+    if (realtimeOverride) return;
+    unsigned totalLen = strip.getLengthTotal();
+    for (size_t i = 0, id = 0; i < packetSize -2 && id < totalLen; i += 3, id++) {
+      setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
     }
+    if (useMainSegmentOnly) strip.trigger();
+    else                    strip.show();
+    return;
   }
 
-  localIP = WLEDNetwork.localIP();
+  IPAddress localIP = WLEDNetwork.localIP();
   //notifier and UDP realtime
-  if (!packetSize || packetSize > UDP_IN_MAXSIZE) return;
-  if (!isSupp && notifierUdp.remoteIP() == localIP) return; //don't process broadcasts we send ourselves
-
-  uint8_t udpIn[packetSize +1];
-  unsigned len;
-  if (isSupp) len = notifier2Udp.read(udpIn, packetSize);
-  else        len =  notifierUdp.read(udpIn, packetSize);
+  if (!isSupp && remoteIP == localIP) return; //don't process broadcasts we send ourselves
 
   // WLED nodes info notifications
-  if (isSupp && udpIn[0] == 255 && udpIn[1] == 1 && len >= 40) {
-    if (!nodeListEnabled || notifier2Udp.remoteIP() == localIP) return;
+  if (isSupp && udpIn[0] == 255 && udpIn[1] == 1 && packetSize >= 40) {
+    if (!nodeListEnabled || remoteIP == localIP) return;
 
     unsigned unit = udpIn[39];
     NodesMap::iterator it = Nodes.find(unit);
@@ -547,7 +1007,7 @@ void handleNotifications()
       it->second.nodeName.trim();
       it->second.nodeType = udpIn[38];
       uint32_t build = 0;
-      if (len >= 44)
+      if (packetSize >= 44)
         for (size_t i=0; i<sizeof(uint32_t); i++)
           build |= udpIn[40+i]<<(8*i);
       it->second.build = build;
@@ -555,11 +1015,24 @@ void handleNotifications()
     return;
   }
 
+  // effect clock sync
+  if (!isSupp && udpIn[0] == CLOCK_SYNC_PACKET && packetSize > 2) {
+    handleClockSyncPacket(udpIn, packetSize, remoteIP);
+    return;
+  }
+
+  // acknowledgement of our v13 notification
+  if (!isSupp && udpIn[0] == 0 && udpIn[1] == NOTIFIER_ACK && packetSize == 3) {
+    handleSyncAck(remoteIP, udpIn[2]);
+    return;
+  }
+
   //wled notifier, ignore if realtime packets active
   if (udpIn[0] == 0 && !realtimeMode && receiveGroups)
   {
-    DEBUG_PRINTF_P(PSTR("UDP notification from: %d.%d.%d.%d\n"), notifierUdp.remoteIP()[0], notifierUdp.remoteIP()[1], notifierUdp.remoteIP()[2], notifierUdp.remoteIP()[3]);
-    parseNotifyPacket(udpIn);
+    DEBUG_PRINTF_P(PSTR("UDP notification from: %d.%d.%d.%d\n"), remoteIP[0], remoteIP[1], remoteIP[2], remoteIP[3]);
+    if (receiveNotificationEffects && (packetSize > 28 || udpIn[1] == NOTIFIER_DELTA)) followClockMaster(remoteIP);
+    handleNotifyPacket(udpIn, packetSize, remoteIP);
     return;
   }
 
@@ -570,11 +1043,11 @@ void handleNotifications()
       //if the number of LEDs in your installation doesn't allow that, please include padding bytes at the end of the last packet
       byte tpmType = udpIn[1];
       if (tpmType == 0xaa) { //TPM2.NET polling, expect answer
-        sendTPM2Ack(); return;
+        sendTPM2Ack(remoteIP); return;
       }
       if (tpmType != 0xda) return; //return if notTPM2.NET data
 
-      realtimeIP = (isSupp) ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
+      realtimeIP = remoteIP;
       realtimeLock(realtimeTimeoutMs, REALTIME_MODE_TPM2NET);
       if (realtimeOverride) return;
 
@@ -600,7 +1073,7 @@ void handleNotifications()
 
     //UDP realtime: 1 warls 2 drgb 3 drgbw 4 dnrgb 5 dnrgbw
     if (udpIn[0] > 0 && udpIn[0] < 6) {
-      realtimeIP = (isSupp) ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
+      realtimeIP = remoteIP;
       DEBUG_PRINTLN(realtimeIP);
       if (packetSize < 2) return;
 
@@ -669,6 +1142,19 @@ void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
   strip.setRealtimePixelColor(pix, RGBW32(r,g,b,w));
 }
 
+// bulk version of setRealtimePixel() for packed RGB (channels = 3) or RGBW (channels = 4) data
+void setRealtimePixels(unsigned start, const uint8_t *data, unsigned count, unsigned channels)
+{
+  int first = start + arlsOffset;
+  if (first < 0) { // offset moves pixels before strip start
+    if ((unsigned)-first >= count) return;
+    data  += (unsigned)-first * channels;
+    count -= (unsigned)-first;
+    first  = 0;
+  }
+  strip.setRealtimePixelColors(first, data, count, channels);
+}
+
 /*********************************************************************************************\
    Refresh aging for remote units, drop if too old...
 \*********************************************************************************************/
@@ -729,9 +1215,11 @@ void sendSysInfoUDP()
     data[40+i] = (build>>(8*i)) & 0xFF;
 
   IPAddress broadcastIP(255, 255, 255, 255);
+  lockUdpSockets();
   notifier2Udp.beginPacket(broadcastIP, udpPort2);
   notifier2Udp.write(data, sizeof(data));
   notifier2Udp.endPacket();
+  unlockUdpSockets();
 }
 
 
@@ -751,11 +1239,74 @@ void sendSysInfoUDP()
 static       size_t sequenceNumber = 0; // this needs to be shared across all outputs
 static const size_t ART_NET_HEADER_SIZE = 12;
 static const byte   ART_NET_HEADER[] PROGMEM = {0x41,0x72,0x74,0x2d,0x4e,0x65,0x74,0x00,0x00,0x50,0x00,0x0e};
+static const size_t ART_NET_DATA_OFFSET = ART_NET_HEADER_SIZE + 6; // header + sequence, physical, universe (2), length (2)
+static const size_t REALTIME_PACKET_SIZE = DDP_HEADER_LEN + DDP_CHANNELS_PER_PACKET; // largest packet (DDP), Art-Net needs 18+512, E1.31 126+512
+
+static const size_t E131_DATA_OFFSET = E131_DMP_DATA + 1; // DMX start code is at E131_DMP_DATA
+static const byte   E131_ACN_ID[] PROGMEM = {0x41,0x53,0x43,0x2d,0x45,0x31,0x2e,0x31,0x37,0x00,0x00,0x00}; // "ASC-E1.17"
+
+static WiFiUDP  realtimeUdp;                    // reused across frames so the socket is not recreated for every frame
+static uint8_t *realtimePacket = nullptr;       // packet assembly buffer, allocated on first use
+static uint8_t  e131OutSyncSequence = 0;
+
+static inline void put16(uint8_t *p, uint16_t v) { p[0] = v >> 8; p[1] = v & 0xFF; } // network byte order
+static inline void put32(uint8_t *p, uint32_t v) { put16(p, v >> 16); put16(p + 2, v & 0xFFFF); }
+
+static inline IPAddress e131MulticastAddress(uint16_t universe) {
+  return IPAddress(239, 255, universe >> 8, universe & 0xFF);
+}
+
+// E1.31 root layer (shared by data and sync packets), CID is derived from MAC address
+static void writeE131RootLayer(uint8_t *p, uint32_t vector) {
+  put16(p + E131_ROOT_PREAMBLE_SIZE, 0x0010);
+  put16(p + E131_ROOT_POSTAMBLE_SIZE, 0x0000);
+  memcpy_P(p + E131_ROOT_ID, E131_ACN_ID, sizeof(E131_ACN_ID));
+  put32(p + E131_ROOT_VECTOR, vector);
+  uint8_t *cid = p + E131_ROOT_CID;
+  memcpy_P(cid, PSTR("WLED-E131"), 10); // 10 bytes incl. terminating zero
+  WiFi.macAddress(cid + 10);
+}
+
+// copy channel data into packet, applying brightness in the same pass
+static inline void copyScaled(uint8_t *dst, const uint8_t *src, size_t len, uint8_t bri) {
+  if (bri == 255) memcpy(dst, src, len);
+  else for (size_t i = 0; i < len; i++) dst[i] = scale8(src[i], bri);
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+// network bus sender task: after a burst of packets sleep for a tick so WiFi/lwIP can drain its transmit queue
+// (a frame of many universes is spread over a few ms instead of overflowing the queue)
+static const uint8_t REALTIME_PACKET_BURST = 8;
+static bool    realtimePacing = false;
+static uint8_t realtimeBurstCount = 0;
+
+void setRealtimePacing(bool enable) {
+  realtimePacing = enable;
+  realtimeBurstCount = 0;
+}
+#endif
+
+// send assembled packet with a single write
+static bool sendRealtimePacket(IPAddress client, uint16_t port, size_t len) {
+  if (!realtimeUdp.beginPacket(client, port)) return false;
+  realtimeUdp.write(realtimePacket, len);
+  bool sent = realtimeUdp.endPacket();
+  #ifdef ARDUINO_ARCH_ESP32
+  if (realtimePacing && ++realtimeBurstCount >= REALTIME_PACKET_BURST) {
+    realtimeBurstCount = 0;
+    vTaskDelay(1);
+  }
+  #endif
+  return sent;
+}
 
 uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const uint8_t *buffer, uint8_t bri, bool isRGBW)  {
   if (!(apActive || interfacesInited) || !client[0] || !length) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
 
-  WiFiUDP ddpUdp;
+  if (!realtimePacket) {
+    realtimePacket = static_cast<uint8_t*>(d_malloc(REALTIME_PACKET_SIZE));
+    if (!realtimePacket) return 1; // no memory
+  }
 
   switch (type) {
     case 0: // DDP
@@ -766,17 +1317,10 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const
 
       // there are 3 channels per RGB pixel
       uint32_t channel = 0; // TODO: allow specifying the start channel
-      // the current position in the buffer
-      size_t bufferOffset = 0;
 
       for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
         if (sequenceNumber > 15) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, DDP_DEFAULT_PORT)) {  // port defined in ESPAsyncE131.h
-          //DEBUG_PRINTLN(F("WiFiUDP.beginPacket returned an error"));
-          return 1; // problem
-        }
-
         // the amount of data is AFTER the header in the current packet
         size_t packetSize = DDP_CHANNELS_PER_PACKET;
 
@@ -790,32 +1334,25 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const
           }
         }
 
-        // write the header
-        /*0*/ddpUdp.write(flags);
+        // header
+        realtimePacket[0] = flags;
         // TODO: sequence number should be 1-15 as 0 means "unused", it has no bad consequences other than out of sequence packet may be accepted
-        /*1*/ddpUdp.write(sequenceNumber++ & 0x0F); // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
-        /*2*/ddpUdp.write(isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
-        /*3*/ddpUdp.write(DDP_ID_DISPLAY);
+        realtimePacket[1] = sequenceNumber++ & 0x0F; // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
+        realtimePacket[2] = isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24;
+        realtimePacket[3] = DDP_ID_DISPLAY;
         // data offset in bytes, 32-bit number, MSB first
-        /*4*/ddpUdp.write(0xFF & (channel >> 24));
-        /*5*/ddpUdp.write(0xFF & (channel >> 16));
-        /*6*/ddpUdp.write(0xFF & (channel >>  8));
-        /*7*/ddpUdp.write(0xFF & (channel      ));
+        realtimePacket[4] = 0xFF & (channel >> 24);
+        realtimePacket[5] = 0xFF & (channel >> 16);
+        realtimePacket[6] = 0xFF & (channel >>  8);
+        realtimePacket[7] = 0xFF & (channel      );
         // data length in bytes, 16-bit number, MSB first
-        /*8*/ddpUdp.write(0xFF & (packetSize >> 8));
-        /*9*/ddpUdp.write(0xFF & (packetSize     ));
-
-        // write the colors, the write write(const uint8_t *buffer, size_t size)
-        // function is just a loop internally too
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        realtimePacket[8] = 0xFF & (packetSize >> 8);
+        realtimePacket[9] = 0xFF & (packetSize     );
+
+        copyScaled(realtimePacket + DDP_HEADER_LEN, buffer + channel, packetSize, bri);
 
-        if (!ddpUdp.endPacket()) {
-          //DEBUG_PRINTLN(F("WiFiUDP.endPacket returned an error"));
+        if (!sendRealtimePacket(client, DDP_DEFAULT_PORT, DDP_HEADER_LEN + packetSize)) {  // port defined in ESPAsyncE131.h
+          //DEBUG_PRINTLN(F("DDP WiFiUDP packet error"));
           return 1; // problem
         }
 
@@ -823,9 +1360,8 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const
       }
     } break;
 
-    case 1: //E1.31
-    {
-    } break;
+    case 1: // E1.31 needs per bus universe and sequence state, see realtimeBroadcastE131()
+      return 1;
 
     case 2: //ArtNet
     {
@@ -834,20 +1370,15 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const
       const size_t ARTNET_CHANNELS_PER_PACKET = isRGBW?512:510; // 512/4=128 RGBW LEDs, 510/3=170 RGB LEDs
       const size_t packetCount = ((channelCount-1)/ARTNET_CHANNELS_PER_PACKET)+1;
 
-      uint32_t channel = 0; 
-      size_t bufferOffset = 0;
+      uint32_t channel = 0;
 
       sequenceNumber++;
 
+      memcpy_P(realtimePacket, ART_NET_HEADER, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
       for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
 
         if (sequenceNumber > 255) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, ARTNET_DEFAULT_PORT)) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.beginPacket returned an error"));
-          return 1; // borked
-        }
-
         size_t packetSize = ARTNET_CHANNELS_PER_PACKET;
 
         if (currentPacket == (packetCount - 1U)) {
@@ -857,25 +1388,17 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const
           }
         }
 
-        byte header_buffer[ART_NET_HEADER_SIZE];
-        memcpy_P(header_buffer, ART_NET_HEADER, ART_NET_HEADER_SIZE);
-        ddpUdp.write(header_buffer, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
-        ddpUdp.write(sequenceNumber & 0xFF); // sequence number. 1..255
-        ddpUdp.write(0x00); // physical - more an FYI, not really used for anything. 0..3
-        ddpUdp.write((currentPacket) & 0xFF); // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
-        ddpUdp.write(0x00); // Universe MSB, unused.
-        ddpUdp.write(0xFF & (packetSize >> 8)); // 16-bit length of channel data, MSB
-        ddpUdp.write(0xFF & (packetSize     )); // 16-bit length of channel data, LSB
-
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        realtimePacket[12] = sequenceNumber & 0xFF; // sequence number. 1..255
+        realtimePacket[13] = 0x00; // physical - more an FYI, not really used for anything. 0..3
+        realtimePacket[14] = (currentPacket) & 0xFF; // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
+        realtimePacket[15] = 0x00; // Universe MSB, unused.
+        realtimePacket[16] = 0xFF & (packetSize >> 8); // 16-bit length of channel data, MSB
+        realtimePacket[17] = 0xFF & (packetSize     ); // 16-bit length of channel data, LSB
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.endPacket returned an error"));
+        copyScaled(realtimePacket + ART_NET_DATA_OFFSET, buffer + channel, packetSize, bri);
+
+        if (!sendRealtimePacket(client, ARTNET_DEFAULT_PORT, ART_NET_DATA_OFFSET + packetSize)) {
+          DEBUG_PRINTLN(F("Art-Net WiFiUDP packet error"));
           return 1; // borked
         }
         channel += packetSize;
@@ -885,6 +1408,151 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, const
   return 0;
 }
 
+// E1.31 output of a network bus: universes start at startUniverse, sequence holds one counter per universe
+// (the caller keeps it so buses sending to different receivers or universes do not share counters)
+uint8_t realtimeBroadcastE131(IPAddress client, uint16_t startUniverse, uint8_t *sequence, uint16_t length, const uint8_t *buffer, uint8_t bri, bool isRGBW) {
+  if (!(apActive || interfacesInited) || !client[0] || !length || !sequence) return 1;
+
+  if (!realtimePacket) {
+    realtimePacket = static_cast<uint8_t*>(d_malloc(REALTIME_PACKET_SIZE));
+    if (!realtimePacket) return 1; // no memory
+  }
+
+  const size_t channelCount = length * (isRGBW?4:3); // 1 channel for every R,G,B,(W?) value
+  const size_t E131_CHANNELS_PER_PACKET = isRGBW?512:510; // do not split pixels across universes
+  const size_t packetCount = ((channelCount-1)/E131_CHANNELS_PER_PACKET)+1;
+  const uint16_t syncUniverse = e131OutSyncUniverse;
+
+  // constant part of the header is assembled once, only lengths, sequence, universe and data change
+  uint8_t *p = realtimePacket;
+  memset(p, 0, E131_DATA_OFFSET);
+  writeE131RootLayer(p, 0x00000004); // VECTOR_ROOT_E131_DATA
+  put32(p + E131_FRAME_VECTOR, 0x00000002); // VECTOR_E131_DATA_PACKET
+  strncpy(reinterpret_cast<char*>(p + E131_FRAME_SOURCE), serverDescription, 63);
+  p[E131_FRAME_PRIORITY] = e131OutPriority;
+  put16(p + E131_FRAME_RESERVED, syncUniverse); // synchronization address
+  p[E131_DMP_VECTOR] = 0x02;  // VECTOR_DMP_SET_PROPERTY
+  p[E131_DMP_TYPE]   = 0xA1;
+  put16(p + E131_DMP_ADDR_FIRST, 0x0000);
+  put16(p + E131_DMP_ADDR_INC, 0x0001);
+  p[E131_DMP_DATA] = 0x00; // DMX start code
+
+  uint32_t channel = 0;
+  for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
+    size_t packetSize = E131_CHANNELS_PER_PACKET;
+    if (currentPacket == (packetCount - 1U) && (channelCount % E131_CHANNELS_PER_PACKET)) {
+      packetSize = channelCount % E131_CHANNELS_PER_PACKET; // last packet
+    }
+    const uint16_t universe = startUniverse + currentPacket;
+    const size_t totalSize = E131_DATA_OFFSET + packetSize;
+
+    put16(p + E131_ROOT_FLENGTH, 0x7000 | (totalSize - E131_ROOT_FLENGTH));
+    put16(p + E131_FRAME_FLENGTH, 0x7000 | (totalSize - E131_FRAME_FLENGTH));
+    p[E131_FRAME_SEQ] = sequence[currentPacket]++;
+    put16(p + E131_FRAME_UNIVERSE, universe);
+    put16(p + E131_DMP_FLENGTH, 0x7000 | (totalSize - E131_DMP_FLENGTH));
+    put16(p + E131_DMP_COUNT, packetSize + 1); // incl. start code
+
+    copyScaled(p + E131_DATA_OFFSET, buffer + channel, packetSize, bri);
+
+    if (!sendRealtimePacket(e131OutMulticast ? e131MulticastAddress(universe) : client, E131_DEFAULT_PORT, totalSize)) {
+      DEBUG_PRINTLN(F("E1.31 WiFiUDP packet error"));
+      return 1;
+    }
+    channel += packetSize;
+  }
+
+  if (syncUniverse) {
+    // E1.31 synchronization packet: receivers holding data for this sync address output it now
+    memset(p, 0, E131_SYNC_PACKET_LEN);
+    writeE131RootLayer(p, 0x00000008); // VECTOR_ROOT_E131_EXTENDED
+    put16(p + E131_ROOT_FLENGTH, 0x7000 | (E131_SYNC_PACKET_LEN - E131_ROOT_FLENGTH));
+    put16(p + E131_FRAME_FLENGTH, 0x7000 | (E131_SYNC_PACKET_LEN - E131_FRAME_FLENGTH));
+    put32(p + E131_FRAME_VECTOR, 0x00000001); // VECTOR_E131_EXTENDED_SYNCHRONIZATION
+    p[E131_SYNC_SEQ] = e131OutSyncSequence++;
+    put16(p + E131_SYNC_ADDRESS, syncUniverse);
+    if (!sendRealtimePacket(e131OutMulticast ? e131MulticastAddress(syncUniverse) : client, E131_DEFAULT_PORT, E131_SYNC_PACKET_LEN)) return 1;
+  }
+  return 0;
+}
+
+/*
+ * WLED delta stream: keyframes carry raw channel data, delta frames carry the XOR against the previous frame,
+ * run-length encoded (control byte with bit 7 set: (n & 0x7F)+1 unchanged channels, else n+1 XOR bytes follow).
+ * Frames are split into chunks that decode independently; receivers that miss a chunk ask for a keyframe.
+ */
+static const size_t WLED_STREAM_MAX_PAYLOAD = REALTIME_PACKET_SIZE - WLED_STREAM_HEADER_LEN;
+static volatile uint32_t keyframeRequestIP = 0; // receiver that asked for a keyframe (0 = none)
+
+// called when a keyframe request is received (see e131.cpp)
+void requestRealtimeKeyframe(IPAddress receiver) {
+  keyframeRequestIP = uint32_t(receiver);
+}
+
+static void writeStreamHeader(uint8_t flags, uint8_t chunk, uint16_t frameSeq, uint32_t offset, uint16_t payloadLen) {
+  memcpy_P(realtimePacket, PSTR("WLDS"), 4);
+  realtimePacket[4] = flags;
+  realtimePacket[5] = chunk;
+  put16(realtimePacket + 6, frameSeq);
+  put32(realtimePacket + 8, offset);
+  put16(realtimePacket + 12, payloadLen);
+}
+
+// reference holds the (brightness scaled) channel data receivers have, it is updated with the sent frame
+// returns 0 on success, a failed send must be followed by a keyframe
+uint8_t realtimeBroadcastDelta(IPAddress client, uint16_t length, const uint8_t *buffer, uint8_t *reference, uint16_t frameSeq, bool keyframe, uint8_t bri, bool isRGBW) {
+  if (!(apActive || interfacesInited) || !client[0] || !length || !reference) return 1;
+
+  if (!realtimePacket) {
+    realtimePacket = static_cast<uint8_t*>(d_malloc(REALTIME_PACKET_SIZE));
+    if (!realtimePacket) return 1; // no memory
+  }
+
+  const uint32_t request = keyframeRequestIP;
+  if (request && (request == uint32_t(client) || client[3] == 255)) { // broadcast destinations serve any receiver
+    keyframeRequestIP = 0;
+    keyframe = true;
+  }
+
+  const size_t channelCount = length * (isRGBW ? 4 : 3);
+  const uint8_t kindFlags = (keyframe ? WLED_STREAM_KEYFRAME : WLED_STREAM_DELTA) | (isRGBW ? WLED_STREAM_RGBW : 0);
+  uint8_t *payload = realtimePacket + WLED_STREAM_HEADER_LEN;
+  size_t pos = 0;
+  uint8_t chunk = 0;
+
+  do {
+    const size_t chunkStart = pos;
+    size_t payloadLen;
+    if (keyframe) {
+      payloadLen = std::min(channelCount - pos, WLED_STREAM_MAX_PAYLOAD);
+      copyScaled(payload, buffer + pos, payloadLen, bri);
+      memcpy(reference + pos, payload, payloadLen);
+      pos += payloadLen;
+    } else {
+      uint8_t *out = payload;
+      const uint8_t *outEnd = payload + WLED_STREAM_MAX_PAYLOAD;
+      while (pos < channelCount && out + 2 <= outEnd) { // room for a control byte and at least one data byte
+        unsigned run = 0;
+        while (pos < channelCount && run < 128 && (bri == 255 ? buffer[pos] : scale8(buffer[pos], bri)) == reference[pos]) { pos++; run++; }
+        if (run) { *out++ = 0x80 | (run - 1); continue; }
+        uint8_t *ctrl = out++;
+        while (pos < channelCount && run < 128 && out < outEnd) {
+          const uint8_t v = bri == 255 ? buffer[pos] : scale8(buffer[pos], bri);
+          if (v == reference[pos]) break;
+          *out++ = v ^ reference[pos];
+          reference[pos++] = v;
+          run++;
+        }
+        *ctrl = run - 1;
+      }
+      payloadLen = out - payload;
+    }
+    writeStreamHeader(kindFlags | (pos >= channelCount ? WLED_STREAM_LAST : 0), chunk++, frameSeq, chunkStart, payloadLen);
+    if (!sendRealtimePacket(client, DDP_DEFAULT_PORT, WLED_STREAM_HEADER_LEN + payloadLen)) return 1;
+  } while (pos < channelCount);
+  return 0;
+}
+
 #ifndef WLED_DISABLE_ESPNOW
 // ESP-NOW message sent callback function
 void espNowSentCB(uint8_t* address, uint8_t status) {
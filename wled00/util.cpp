@@ -631,9 +631,9 @@ um_data_t* simulateSound(uint8_t simulationId)
       break;
     case UMS_WeWillRockYou:
       if (ms%2000 < 200) {
-        volumeSmth = hw_random8();
+        volumeSmth = fx_random8();
         for (int i = 0; i<5; i++)
-          fftResult[i] = hw_random8();
+          fftResult[i] = fx_random8();
       }
       else if (ms%2000 < 400) {
         volumeSmth = 0;
@@ -641,9 +641,9 @@ um_data_t* simulateSound(uint8_t simulationId)
           fftResult[i] = 0;
       }
       else if (ms%2000 < 600) {
-        volumeSmth = hw_random8();
+        volumeSmth = fx_random8();
         for (int i = 5; i<11; i++)
-          fftResult[i] = hw_random8();
+          fftResult[i] = fx_random8();
       }
       else if (ms%2000 < 800) {
         volumeSmth = 0;
@@ -651,9 +651,9 @@ um_data_t* simulateSound(uint8_t simulationId)
           fftResult[i] = 0;
       }
       else if (ms%2000 < 1000) {
-        volumeSmth = hw_random8();
+        volumeSmth = fx_random8();
         for (int i = 11; i<16; i++)
-          fftResult[i] = hw_random8();
+          fftResult[i] = fx_random8();
       }
       else {
         volumeSmth = 0;
@@ -673,7 +673,7 @@ um_data_t* simulateSound(uint8_t simulationId)
       break;
   }
 
-  samplePeak    = hw_random8() > 250;
+  samplePeak    = fx_random8() > 250;
   FFT_MajorPeak = 21 + (volumeSmth*volumeSmth) / 8.0f; // walk thru full range of 21hz...8200hz
   maxVol        = 31;  // this gets feedback fro UI
   binNum        = 8;   // this gets feedback fro UI
@@ -741,7 +741,7 @@ void enumerateLedmaps() {
 uint8_t get_random_wheel_index(uint8_t pos) {
   uint8_t r = 0, x = 0, y = 0, d = 0;
   while (d < 42) {
-    r = hw_random8();
+    r = fx_random8();
     x = abs(pos - r);
     y = 255 - x;
     d = MIN(x, y);
@@ -482,6 +482,7 @@ void WLED::setup()
   handleBootLoop(); // check for bootloop and take action (requires WLED_FS)
   initPresetsFile();
   updateFSInfo();
+  presetsVersion = hw_random16(); // ETags of presets.json must not repeat after reboot
 
   // generate module IDs must be done before AP setup
   escapedMac = WiFi.macAddress();
@@ -722,6 +723,7 @@ void WLED::initAP(bool resetAP)
   {
     DEBUG_PRINTLN(F("Init AP interfaces"));
     server.begin();
+    lockUdpSockets();
     if (udpPort > 0 && udpPort != ntpLocalPort) {
       udpConnected = notifierUdp.begin(udpPort);
     }
@@ -731,6 +733,7 @@ void WLED::initAP(bool resetAP)
     if (udpPort2 > 0 && udpPort2 != ntpLocalPort && udpPort2 != udpPort && udpPort2 != udpRgbPort) {
       udp2Connected = notifier2Udp.begin(udpPort2);
     }
+    unlockUdpSockets();
     e131.begin(false, e131Port, e131Universe, E131_MAX_UNIVERSE_COUNT);
     ddp.begin(false, DDP_DEFAULT_PORT);
 
@@ -931,11 +934,13 @@ void WLED::initInterfaces()
   server.begin();
 
   if (udpPort > 0 && udpPort != ntpLocalPort) {
+    lockUdpSockets();
     udpConnected = notifierUdp.begin(udpPort);
     if (udpConnected && udpRgbPort != udpPort)
       udpRgbConnected = rgbUdp.begin(udpRgbPort);
     if (udpConnected && udpPort2 != udpPort && udpPort2 != udpRgbPort)
       udp2Connected = notifier2Udp.begin(udpPort2);
+    unlockUdpSockets();
   }
   if (ntpEnabled)
     ntpConnected = ntpUdp.begin(ntpLocalPort);
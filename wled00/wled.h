@@ -393,6 +393,7 @@ WLED_GLOBAL bool cctICused          _INIT(false); // CCT IC used (Athom 15W bulb
 WLED_GLOBAL bool gammaCorrectCol    _INIT(true);  // use gamma correction on colors
 WLED_GLOBAL bool gammaCorrectBri    _INIT(false); // use gamma correction on brightness
 WLED_GLOBAL float gammaCorrectVal   _INIT(2.2f);  // gamma correction value
+WLED_GLOBAL uint16_t psFrameBudget  _INIT(0);     // particle system update+render time budget in microseconds, 0 = unlimited
 
 WLED_GLOBAL byte colPri[] _INIT_N(({ 0, 0, 0, 0 }));   // current RGB(W) primary color. colPri[] should be updated if you want to change the color.
 WLED_GLOBAL byte colSec[] _INIT_N(({ 0, 0, 0, 0 }));   // current RGB(W) secondary color
@@ -433,6 +434,13 @@ WLED_GLOBAL uint16_t realtimeTimeoutMs _INIT(2500);               // ms timeout
 WLED_GLOBAL int arlsOffset _INIT(0);                              // realtime LED offset
 WLED_GLOBAL bool arlsDisableGammaCorrection _INIT(true);          // activate if gamma correction is handled by the source
 WLED_GLOBAL bool arlsForceMaxBri _INIT(false);                    // enable to force max brightness if source has very dark colors that would be black
+WLED_GLOBAL uint16_t realtimeCanvasWidth _INIT(0);               // realtime input resolution if smaller than matrix (0 = 1:1 mapping)
+WLED_GLOBAL uint16_t realtimeCanvasHeight _INIT(0);
+WLED_GLOBAL bool realtimeCanvasBilinear _INIT(true);              // upscale realtime canvas with bilinear filtering (else nearest neighbour)
+WLED_GLOBAL byte realtimePlayoutFrames _INIT(0);                  // DDP playout (jitter) buffer depth in frames (0 = show on arrival, max 3)
+WLED_GLOBAL uint16_t realtimeJitter _INIT(0);                     // smoothed realtime frame arrival jitter (ms)
+WLED_GLOBAL uint32_t realtimeFramesLate _INIT(0);                 // buffered frames that arrived after their show time (buffer ran empty)
+WLED_GLOBAL uint32_t realtimeFramesDropped _INIT(0);              // buffered frames dropped because the buffer was full
 
 #ifdef WLED_ENABLE_DMX
  #if defined(CONFIG_IDF_TARGET_ESP32C5) || defined(CONFIG_IDF_TARGET_ESP32C6) || defined(CONFIG_IDF_TARGET_ESP32C61) || defined(CONFIG_IDF_TARGET_ESP32P4) 
@@ -473,6 +481,17 @@ WLED_GLOBAL uint16_t DMXSegmentSpacing _INIT(0);                  // Number of v
 WLED_GLOBAL byte e131LastSequenceNumber[E131_MAX_UNIVERSE_COUNT]; // to detect packet loss
 WLED_GLOBAL bool e131Multicast _INIT(false);                      // multicast or unicast
 WLED_GLOBAL bool e131SkipOutOfSequence _INIT(false);              // freeze instead of flickering
+WLED_GLOBAL byte e131MergeMode _INIT(E131_MERGE_NONE);            // merge of several sources sending the same universe
+WLED_GLOBAL uint32_t e131LateUniverses _INIT(0);                  // universes received after their frame was shown (discarded)
+WLED_GLOBAL uint32_t e131DroppedUniverses _INIT(0);               // universes missing from shown frames
+WLED_GLOBAL uint32_t udpRxPackets _INIT(0);                       // packets received on notifier, realtime and Hyperion ports
+WLED_GLOBAL uint32_t udpRxDropped _INIT(0);                       // packets dropped because the main loop did not keep up (ESP32)
+WLED_GLOBAL uint32_t udpRxSkipped _INIT(0);                       // realtime frames skipped because a newer frame was already received (ESP32)
+WLED_GLOBAL uint16_t udpRxRate _INIT(0);                          // received packets per second
+WLED_GLOBAL uint16_t e131OutUniverse _INIT(1);                    // first universe of E1.31 network buses without their own start universe
+WLED_GLOBAL byte e131OutPriority _INIT(100);                      // E1.31 output priority (0-200)
+WLED_GLOBAL bool e131OutMulticast _INIT(false);                   // send E1.31 output to universe multicast addresses instead of bus IP
+WLED_GLOBAL uint16_t e131OutSyncUniverse _INIT(0);                // E1.31 output synchronization universe (0 = no sync packets)
 WLED_GLOBAL uint16_t pollReplyCount _INIT(0);                     // count number of replies for ArtPoll node report
 
 // mqtt
@@ -664,6 +683,14 @@ WLED_GLOBAL bool receiveNotificationEffects    _INIT(true);       // apply effec
 WLED_GLOBAL bool receiveNotificationPalette    _INIT(true);       // apply palette
 WLED_GLOBAL bool receiveSegmentOptions         _INIT(false);      // apply segment options
 WLED_GLOBAL bool receiveSegmentBounds          _INIT(false);      // apply segment bounds (start, stop, offset)
+WLED_GLOBAL bool clockSyncEnabled _INIT(true);                    // measure effect clock of notification sender with two-way timestamps
+WLED_GLOBAL bool clockSyncFrames  _INIT(false);                   // render frames on boundaries of the shared effect clock
+WLED_GLOBAL uint16_t clockSyncRTT _INIT(0);                       // round trip of best clock sync exchange (us), 0 if not synchronized
+WLED_GLOBAL int16_t clockSyncDrift _INIT(0);                      // clock drift against sync master (ppm)
+WLED_GLOBAL bool fxDeterministic _INIT(false);                    // effects use PRNG seeded with shared frame number (identical frames on synced nodes)
+WLED_GLOBAL uint16_t canvasLength _INIT(0);                       // length of virtual canvas shared by synced nodes (1D, 0 = none)
+WLED_GLOBAL uint16_t canvasOffset _INIT(0);                       // position of this strip on the virtual canvas
+WLED_GLOBAL bool notifyDelta  _INIT(true);                        // send only changes to receivers acknowledging v13 notifications
 WLED_GLOBAL bool receiveDirect _INIT(true);                       // receive UDP/Hyperion realtime
 WLED_GLOBAL bool notifyDirect _INIT(true);                        // send notification if change via UI or HTTP API
 WLED_GLOBAL bool notifyButton _INIT(true);                        // send if updated by button or infrared remote
@@ -732,6 +759,7 @@ WLED_GLOBAL bool useMainSegmentOnly _INIT(false);
 WLED_GLOBAL bool realtimeRespectLedMaps _INIT(true);                     // Respect LED maps when receiving realtime data
 
 WLED_GLOBAL unsigned long lastInterfaceUpdate _INIT(0);
+WLED_GLOBAL uint16_t interfaceUpdateCooldown _INIT(INTERFACE_UPDATE_COOLDOWN); // min. time between WS/Alexa/MQTT pushes (coalesces changes)
 WLED_GLOBAL byte interfaceUpdateCallMode _INIT(CALL_MODE_INIT);
 
 // alexa udp
@@ -769,6 +797,7 @@ WLED_GLOBAL Toki toki _INIT(Toki());
 WLED_GLOBAL size_t fsBytesUsed _INIT(0);
 WLED_GLOBAL size_t fsBytesTotal _INIT(0);
 WLED_GLOBAL unsigned long presetsModifiedTime _INIT(0L);
+WLED_GLOBAL uint16_t presetsVersion _INIT(0);          // changes with every presets.json write (ETag), random at boot
 WLED_GLOBAL bool doCloseFile _INIT(false);
 
 // presets
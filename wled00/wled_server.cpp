@@ -79,10 +79,8 @@ static void generateEtag(char *etag, uint16_t eTagSuffix) {
   sprintf_P(etag, PSTR("%u-%02x-%04x"), WEB_BUILD_TIME, cacheInvalidate, eTagSuffix);
 }
 
-static void setStaticContentCacheHeaders(AsyncWebServerResponse *response, int code, uint16_t eTagSuffix = 0) {
-  // Only send ETag for 200 (OK) responses
-  if (code != 200) return;
-
+// cache headers for content identified by etag (browser revalidates using "If-None-Match")
+void setContentCacheHeaders(AsyncWebServerResponse *response, const char *etag) {
   // https://medium.com/@codebyamir/a-web-developers-guide-to-browser-caching-cc41f3b73e7c
   #ifndef WLED_DEBUG
   // this header name is misleading, "no-cache" will not disable cache,
@@ -91,27 +89,37 @@ static void setStaticContentCacheHeaders(AsyncWebServerResponse *response, int c
   #else
   response->addHeader(FPSTR(s_cache_control), F("no-store,max-age=0"));  // prevent caching if debug build
   #endif
-  char etag[32];
-  generateEtag(etag, eTagSuffix);
   response->addHeader(F("ETag"), etag);
 }
 
-static bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest *request, int code, uint16_t eTagSuffix = 0) {
-  // Only send 304 (Not Modified) if response code is 200 (OK)
-  if (code != 200) return false;
-
+// sends 304 (Not Modified) if the browser already has the content identified by etag
+bool handleIfNoneMatch(AsyncWebServerRequest *request, const char *etag) {
   AsyncWebHeader *header = request->getHeader(F("If-None-Match"));
-  char etag[32];
-  generateEtag(etag, eTagSuffix);
   if (header && header->value() == etag) {
     AsyncWebServerResponse *response = request->beginResponse(304);
-    setStaticContentCacheHeaders(response, code, eTagSuffix);
+    setContentCacheHeaders(response, etag);
     request->send(response);
     return true;
   }
   return false;
 }
 
+static void setStaticContentCacheHeaders(AsyncWebServerResponse *response, int code, uint16_t eTagSuffix = 0) {
+  // Only send ETag for 200 (OK) responses
+  if (code != 200) return;
+  char etag[32];
+  generateEtag(etag, eTagSuffix);
+  setContentCacheHeaders(response, etag);
+}
+
+static bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest *request, int code, uint16_t eTagSuffix = 0) {
+  // Only send 304 (Not Modified) if response code is 200 (OK)
+  if (code != 200) return false;
+  char etag[32];
+  generateEtag(etag, eTagSuffix);
+  return handleIfNoneMatch(request, etag);
+}
+
 /**
  * Handles the request for a static file.
  * If the file was found in the filesystem, it will be sent to the client.
@@ -206,7 +214,10 @@ static void handleUpload(AsyncWebServerRequest *request, const String& filename,
 
     request->_tempFile = WLED_FS.open(finalname, "w");
     DEBUG_PRINTF_P(PSTR("Uploading %s\n"), finalname.c_str());
-    if (finalname.equals(FPSTR(getPresetsFileName()))) presetsModifiedTime = toki.second();
+    if (finalname.equals(FPSTR(getPresetsFileName()))) {
+      presetsModifiedTime = toki.second();
+      presetsVersion++;
+    }
   }
   if (len) {
     request->_tempFile.write(data,len);
@@ -5,20 +5,159 @@
  */
 #ifdef WLED_ENABLE_WEBSOCKETS
 
-// forward declarations
-static bool sendLiveLedsWs(uint32_t wsClient);
-
 // define some constants for binary protocols, dont use defines but C++ style constexpr
 constexpr uint8_t BINARY_PROTOCOL_GENERIC = 0xFF; // generic / auto detect NOT IMPLEMENTED
 constexpr uint8_t BINARY_PROTOCOL_E131    = P_E131; // = 0, untested!
 constexpr uint8_t BINARY_PROTOCOL_ARTNET  = P_ARTNET; // = 1, untested!
 constexpr uint8_t BINARY_PROTOCOL_DDP     = P_DDP; // = 2
 
-static uint16_t wsLiveClientId = 0;
 static unsigned long wsLastLiveTime = 0;
 //static uint8_t* wsFrameBuffer = nullptr;
 
-#define WS_LIVE_INTERVAL 40
+#define WS_LIVE_INTERVAL 40 // default live view frame interval (25 fps)
+#ifdef ESP8266
+#define WS_LIVE_MAX_CLIENTS 2
+#define MAX_LIVE_LEDS_WS 256U
+#else
+#define WS_LIVE_MAX_CLIENTS 4
+#define MAX_LIVE_LEDS_WS 1024U
+#endif
+
+// live view clients, {"lv":true} gets v1/v2 frames (every n-th LED), {"lv":3,"fps":x} area-averaged key/delta frames
+typedef struct WsLiveClient {
+  uint32_t id;        // WS client ID, 0 = unused slot
+  uint8_t  version;   // live protocol version
+  uint16_t interval;  // ms between frames
+  unsigned long last; // time of last frame
+  uint8_t *frame;     // v3: last frame sent (base for delta), nullptr forces key frame
+  uint16_t w, h;      // v3: dimensions of last frame
+} ws_live_client_t;
+
+static ws_live_client_t wsLiveClients[WS_LIVE_MAX_CLIENTS] = {};
+
+// live view requests from the async WS task, applied in handleWs() (which owns the frame buffers)
+// single producer/single consumer ring, a request lost on overflow is recovered by the gone-client check
+#define WS_LIVE_REQUESTS (2*WS_LIVE_MAX_CLIENTS)
+typedef struct WsLiveRequest {
+  uint32_t id;
+  uint8_t  version; // 0 = stop (client disconnected)
+  uint8_t  fps;
+} ws_live_request_t;
+
+static ws_live_request_t wsLiveRequests[WS_LIVE_REQUESTS];
+static volatile uint8_t  wsLiveRequestHead = 0; // written by async WS task only
+static volatile uint8_t  wsLiveRequestTail = 0; // written by main loop only
+
+static void setWsLiveClient(uint32_t id, unsigned version, unsigned fps) {
+  ws_live_client_t *slot = nullptr;
+  for (auto &lc : wsLiveClients) {
+    if (lc.id == id || (!slot && !lc.id)) slot = &lc;
+    if (lc.id == id) break;
+  }
+  if (!slot) return; // no free slot
+  if (slot->frame) p_free(slot->frame);
+  slot->frame = nullptr;
+  slot->id = version ? id : 0;
+  slot->version = version;
+  slot->interval = 1000 / constrain(fps, 1U, 50U);
+  slot->last = 0;
+}
+
+static void requestWsLiveClient(uint32_t id, unsigned version, unsigned fps) {
+  uint8_t head = wsLiveRequestHead;
+  uint8_t next = (head + 1) % WS_LIVE_REQUESTS;
+  if (next == wsLiveRequestTail) return; // full
+  wsLiveRequests[head] = {id, uint8_t(min(version, 255U)), uint8_t(constrain(fps, 1U, 50U))};
+  wsLiveRequestHead = next;
+}
+
+/*
+ * State patches: clients announcing {"pt":true} receive only the top level state/info values
+ * (and segments) that changed since the previous broadcast, tagged with base and new version.
+ * Hashes of the values last broadcast are kept so no copy of the previous document is needed.
+ */
+typedef struct WsValueHash {
+  uint32_t key;   // hash of section + key name (or segment id)
+  uint32_t value; // hash of serialized value
+} ws_value_hash_t;
+
+static std::vector<ws_value_hash_t> wsHashes;   // values of last broadcast
+static std::vector<uint32_t> wsPatchClients;    // IDs of clients applying patches
+static uint16_t wsVersion = 0;                  // version of last broadcast
+
+class HashPrint : public Print {
+  public:
+    uint32_t hash = 2166136261UL; // FNV-1a
+    size_t write(uint8_t c) override { hash = (hash ^ c) * 16777619UL; return 1; }
+    using Print::write;
+};
+
+static uint32_t hashKey(const char *key, char section) {
+  uint32_t h = 2166136261UL ^ section;
+  while (*key) h = (h ^ uint8_t(*key++)) * 16777619UL;
+  return h;
+}
+
+static uint32_t hashValue(JsonVariantConst v) {
+  HashPrint p;
+  serializeJson(v, p);
+  return p.hash;
+}
+
+// records value hash for next broadcast, returns true if it differs from last broadcast
+static bool wsValueChanged(std::vector<ws_value_hash_t> &next, uint32_t key, uint32_t value) {
+  next.push_back({key, value});
+  for (const auto &h : wsHashes) if (h.key == key) return h.value != value;
+  return true;
+}
+
+// remove members of obj that did not change since last broadcast
+static void wsRemoveUnchanged(JsonObject obj, char section, std::vector<ws_value_hash_t> &next, bool strip) {
+  const char *unchanged[64];
+  size_t n = 0;
+  for (JsonPair kv : obj) {
+    if (section == 's' && kv.key() == "seg") continue; // segments are compared individually
+    if (wsValueChanged(next, hashKey(kv.key().c_str(), section), hashValue(kv.value())) || !strip || n >= 64) continue;
+    unchanged[n++] = kv.key().c_str();
+  }
+  for (size_t i = 0; i < n; i++) obj.remove(unchanged[i]); // key strings remain valid, removal does not free memory
+}
+
+// hashes values for next broadcast and (if strip) removes those unchanged since last broadcast
+// returns false if segment list changed (full "seg" array kept)
+static bool wsMakePatch(JsonObject state, JsonObject info, std::vector<ws_value_hash_t> &next, bool strip) {
+  bool segIdsSame = true;
+  JsonArray segs = state["seg"];
+  if (!segs.isNull()) {
+    uint32_t ids = 2166136261UL;
+    for (JsonObject seg : segs) ids = (ids ^ seg["id"].as<unsigned>()) * 16777619UL;
+    segIdsSame = !wsValueChanged(next, hashKey("seg", 'i'), ids);
+    for (size_t i = segs.size(); i-- > 0;) {
+      JsonObject seg = segs[i];
+      uint32_t key = hashKey("seg", 's') + seg["id"].as<unsigned>() + 1;
+      if (!wsValueChanged(next, key, hashValue(seg)) && segIdsSame && strip) segs.remove(i);
+    }
+    if (strip && segIdsSame && segs.size() == 0) state.remove("seg");
+  }
+  wsRemoveUnchanged(state, 's', next, strip);
+  wsRemoveUnchanged(info,  'i', next, strip);
+  return segIdsSame;
+}
+
+static bool isWsPatchClient(uint32_t id) {
+  for (uint32_t c : wsPatchClients) if (c == id) return true;
+  return false;
+}
+
+static void setWsPatchClient(uint32_t id, bool enable) {
+  for (size_t i = 0; i < wsPatchClients.size(); i++) if (wsPatchClients[i] == id) {
+    if (!enable) wsPatchClients.erase(wsPatchClients.begin() + i);
+    return;
+  }
+  if (!enable) return;
+  wsPatchClients.push_back(id);
+  wsHashes.clear(); // hashes are not kept while no client applies patches, next patch contains everything
+}
 
 void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len)
 {
@@ -27,8 +166,8 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
     DEBUG_PRINTLN(F("WS client connected."));
     sendDataWs(client);
   } else if(type == WS_EVT_DISCONNECT){
-    //client disconnected
-    if (client->id() == wsLiveClientId) wsLiveClientId = 0;
+    //client disconnected (patch client list is cleaned up by sendDataWs() which holds the JSON buffer lock)
+    requestWsLiveClient(client->id(), 0, 0);
     DEBUG_PRINTLN(F("WS client disconnected."));
   } else if(type == WS_EVT_DATA){
     // data packet
@@ -60,7 +199,11 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
           //if the received value is just "{"v":true}", send only to this client
           verboseResponse = true;
         } else if (root.containsKey("lv")) {
-          wsLiveClientId = root["lv"] ? client->id() : 0;
+          unsigned version = root["lv"].is<bool>() ? (root["lv"].as<bool>() ? 1 : 0) : root["lv"].as<unsigned>();
+          requestWsLiveClient(client->id(), version, root[F("fps")] | (1000 / WS_LIVE_INTERVAL));
+        } else if (root.containsKey("pt")) {
+          setWsPatchClient(client->id(), root["pt"]);
+          verboseResponse = true; // full state (with version) as base for patches
         } else {
           verboseResponse = deserializeState(root);
         }
@@ -149,6 +292,30 @@ void sendDataWs(AsyncWebSocketClient * client)
   JsonObject info  = pDoc->createNestedObject("info");
   serializeInfo(info);
 
+  if (!client && !wsPatchClients.empty()) {
+    // drop clients that went away without disconnect event
+    for (size_t i = wsPatchClients.size(); i-- > 0;) if (!ws.client(wsPatchClients[i])) wsPatchClients.erase(wsPatchClients.begin() + i);
+  }
+  if (!client && !wsPatchClients.empty()) {
+    // patch is only sent if all clients can apply it, otherwise full state goes to everyone (with version as new base)
+    bool strip = ws.count() <= wsPatchClients.size();
+    std::vector<ws_value_hash_t> next;
+    next.reserve(wsHashes.size() + 8);
+    bool segIdsSame = wsMakePatch(state, info, next, strip);
+    wsHashes.swap(next);
+    uint16_t base = wsVersion++;
+    if (strip) {
+      if (state.size() == 0) pDoc->remove("state");
+      if (info.size() == 0) pDoc->remove("info");
+      JsonObject patch = pDoc->createNestedObject("p");
+      patch["b"] = base;
+      patch["v"] = wsVersion;
+      if (!segIdsSame) patch[F("sa")] = true; // "seg" holds all segments
+    } else
+      (*pDoc)[F("pv")] = wsVersion;
+  } else
+    (*pDoc)[F("pv")] = wsVersion;
+
   size_t len = measureJson(*pDoc);
   DEBUG_PRINTF_P(PSTR("JSON buffer size: %u for WS request (%u).\n"), pDoc->memoryUsage(), len);
 
@@ -183,17 +350,10 @@ void sendDataWs(AsyncWebSocketClient * client)
   releaseJSONBufferLock();
 }
 
-static bool sendLiveLedsWs(uint32_t wsClient)
+// v1/v2: every n-th LED, full frames
+static bool sendLiveLedsWsLegacy(AsyncWebSocketClient *wsc)
 {
-  AsyncWebSocketClient * wsc = ws.client(wsClient);
-  if (!wsc || wsc->queueLength() > 0) return false; //only send if queue free
-
   size_t used = strip.getLengthTotal();
-#ifdef ESP8266
-  const size_t MAX_LIVE_LEDS_WS = 256U;
-#else
-  const size_t MAX_LIVE_LEDS_WS = 1024U;
-#endif
   size_t n = ((used -1)/MAX_LIVE_LEDS_WS) +1; //only serve every n'th LED if count over MAX_LIVE_LEDS_WS
   size_t pos = 2;  // start of data
 #ifndef WLED_DISABLE_2D
@@ -242,6 +402,112 @@ static bool sendLiveLedsWs(uint32_t wsClient)
   return true;
 }
 
+// v3 delta: runs of changed pixels as [unchanged pixels before run (16 bit BE)][run length][RGB * run length]
+// returns encoded size, only measures if out is nullptr
+static size_t encodeLiveDelta(const uint8_t *prev, const uint8_t *cur, size_t pixels, uint8_t *out)
+{
+  size_t len = 0, skip = 0;
+  for (size_t i = 0; i < pixels;) {
+    if (!memcmp(prev + i*3, cur + i*3, 3)) { skip++; i++; continue; }
+    size_t count = 1;
+    while (i + count < pixels && count < 255 && memcmp(prev + (i+count)*3, cur + (i+count)*3, 3)) count++;
+    if (out) {
+      out[len]   = skip >> 8;
+      out[len+1] = skip & 0xFF;
+      out[len+2] = count;
+      memcpy(out + len + 3, cur + i*3, count*3);
+    }
+    len += 3 + count*3;
+    i += count;
+    skip = 0;
+  }
+  return len;
+}
+
+// v3: ['L'][3][flags: 1 = key frame][width (16 bit BE)][height (16 bit BE)] followed by RGB of all
+// pixels (key frame) or changes against the previous frame (delta), pixels are area averages
+static bool sendLiveLedsWsV3(AsyncWebSocketClient *wsc, ws_live_client_t &lc)
+{
+  unsigned width = strip.getLengthTotal();
+  unsigned height = 1;
+#ifndef WLED_DISABLE_2D
+  if (strip.isMatrix) {
+    // ignore anything behid matrix (i.e. extra strip)
+    width  = Segment::maxWidth;
+    height = Segment::maxHeight;
+  }
+#endif
+  unsigned n = 1; // each preview pixel is the average of n (2D: n x n) LEDs
+  while (((width + n-1)/n) * ((height + n-1)/n) > MAX_LIVE_LEDS_WS) n++;
+  const unsigned w = (width + n-1)/n;
+  const unsigned h = (height + n-1)/n;
+  const size_t pixels = w*h;
+
+  uint8_t *cur = static_cast<uint8_t*>(p_malloc(pixels*3));
+  if (!cur) return false; //out of memory
+  uint8_t *px = cur;
+  for (unsigned y = 0; y < h; y++) for (unsigned x = 0; x < w; x++) {
+    unsigned r = 0, g = 0, b = 0, cnt = 0;
+    unsigned yEnd = min((y+1)*n, height);
+    unsigned xEnd = min((x+1)*n, width);
+    for (unsigned yy = y*n; yy < yEnd; yy++) for (unsigned xx = x*n; xx < xEnd; xx++) {
+      uint32_t c = strip.getPixelColor(xx + yy*width); // note: LEDs mapped outside of valid range are set to black
+      r += qadd8(W(c), R(c)); // add white channel to RGB channels as a simple RGBW -> RGB map
+      g += qadd8(W(c), G(c));
+      b += qadd8(W(c), B(c));
+      cnt++;
+    }
+    *px++ = bri ? r/cnt : 0;
+    *px++ = bri ? g/cnt : 0;
+    *px++ = bri ? b/cnt : 0;
+  }
+
+  bool key = !lc.frame || lc.w != w || lc.h != h;
+  size_t len = key ? pixels*3 : encodeLiveDelta(lc.frame, cur, pixels, nullptr);
+  if (!key && len >= pixels*3) {
+    key = true;
+    len = pixels*3;
+  }
+  if (len == 0) { // nothing changed
+    p_free(cur);
+    return true;
+  }
+
+  AsyncWebSocketBuffer wsBuf(7 + len);
+  uint8_t* buffer = wsBuf ? reinterpret_cast<uint8_t*>(wsBuf.data()) : nullptr;
+  if (!buffer) {
+    p_free(cur);
+    return false; //out of memory
+  }
+  buffer[0] = 'L';
+  buffer[1] = 3; //version
+  buffer[2] = key;
+  buffer[3] = w >> 8;
+  buffer[4] = w & 0xFF;
+  buffer[5] = h >> 8;
+  buffer[6] = h & 0xFF;
+  if (key) memcpy(buffer + 7, cur, len);
+  else     encodeLiveDelta(lc.frame, cur, pixels, buffer + 7);
+  wsc->binary(std::move(wsBuf));
+
+  if (lc.frame) p_free(lc.frame);
+  lc.frame = cur;
+  lc.w = w;
+  lc.h = h;
+  return true;
+}
+
+static bool sendLiveLedsWs(ws_live_client_t &lc)
+{
+  AsyncWebSocketClient * wsc = ws.client(lc.id);
+  if (!wsc) {
+    setWsLiveClient(lc.id, 0, 0); // client is gone
+    return true;
+  }
+  if (wsc->queueLength() > 0) return false; //only send if queue free
+  return lc.version >= 3 ? sendLiveLedsWsV3(wsc, lc) : sendLiveLedsWsLegacy(wsc);
+}
+
 void handleWs()
 {
   if (millis() - wsLastLiveTime > WS_LIVE_INTERVAL)
@@ -251,10 +517,18 @@ void handleWs()
     #else
     ws.cleanupClients();
     #endif
-    bool success = true;
-    if (wsLiveClientId) success = sendLiveLedsWs(wsLiveClientId);
     wsLastLiveTime = millis();
-    if (!success) wsLastLiveTime -= 20; //try again in 20ms if failed due to non-empty WS queue
+  }
+  while (wsLiveRequestTail != wsLiveRequestHead) {
+    const ws_live_request_t &req = wsLiveRequests[wsLiveRequestTail];
+    setWsLiveClient(req.id, req.version, req.fps);
+    wsLiveRequestTail = (wsLiveRequestTail + 1) % WS_LIVE_REQUESTS;
+  }
+  for (auto &lc : wsLiveClients) {
+    if (!lc.id || millis() - lc.last < lc.interval) continue;
+    bool success = sendLiveLedsWs(lc);
+    lc.last = millis();
+    if (!success) lc.last -= lc.interval/2; //try again sooner if failed due to non-empty WS queue
   }
 }
 
@@ -359,6 +359,7 @@ void getSettingsJS(byte subPage, Print& settingsScript)
     printSetFormCheckbox(settingsScript,PSTR("CR"),strip.cctFromRgb);
     printSetFormValue(settingsScript,PSTR("CB"),Bus::getCCTBlend());
     printSetFormValue(settingsScript,PSTR("FR"),strip.getTargetFps());
+    printSetFormValue(settingsScript,PSTR("PSB"),psFrameBudget);
     printSetFormValue(settingsScript,PSTR("AW"),Bus::getGlobalAWMode());
 
     unsigned sumMa = 0;
@@ -381,6 +382,7 @@ void getSettingsJS(byte subPage, Print& settingsScript)
       char la[4] = "LA"; la[2] = offset+s; la[3] = 0; //LED current
       char ma[4] = "MA"; ma[2] = offset+s; ma[3] = 0; //max per-port PSU current
       char hs[4] = "HS"; hs[2] = offset+s; hs[3] = 0; //hostname (for network types, custom text for others)
+      char un[4] = "UN"; un[2] = offset+s; un[3] = 0; //E1.31 start universe
       settingsScript.print(F("addLEDs(1);"));
       uint8_t pins[OUTPUT_MAX_PINS];
       int nPins = bus->getPins(pins);
@@ -418,7 +420,8 @@ void getSettingsJS(byte subPage, Print& settingsScript)
           case 20000 : speed = 4; break;
         }
       }
-      printSetFormValue(settingsScript,sp,speed);
+      if (bus->getType() == TYPE_NET_E131_RGB) printSetFormValue(settingsScript,un,speed);
+      else printSetFormValue(settingsScript,sp,speed);
       printSetFormValue(settingsScript,la,bus->getLEDCurrent());
       printSetFormValue(settingsScript,ma,bus->getMaxCurrent());
       printSetFormValue(settingsScript,hs,bus->getCustomText().c_str());
@@ -493,11 +496,18 @@ void getSettingsJS(byte subPage, Print& settingsScript)
     printSetFormCheckbox(settingsScript,PSTR("RP"),receiveNotificationPalette);
     printSetFormCheckbox(settingsScript,PSTR("SO"),receiveSegmentOptions);
     printSetFormCheckbox(settingsScript,PSTR("SG"),receiveSegmentBounds);
+    printSetFormCheckbox(settingsScript,PSTR("CK"),clockSyncEnabled);
+    printSetFormCheckbox(settingsScript,PSTR("FL"),clockSyncFrames);
+    printSetFormCheckbox(settingsScript,PSTR("DF"),fxDeterministic);
+    printSetFormValue(settingsScript,PSTR("VL"),canvasLength);
+    printSetFormValue(settingsScript,PSTR("VO"),canvasOffset);
     printSetFormCheckbox(settingsScript,PSTR("SS"),sendNotifications);
     printSetFormCheckbox(settingsScript,PSTR("SD"),notifyDirect);
     printSetFormCheckbox(settingsScript,PSTR("SB"),notifyButton);
     printSetFormCheckbox(settingsScript,PSTR("SH"),notifyHue);
     printSetFormValue(settingsScript,PSTR("UR"),udpNumRetries);
+    printSetFormCheckbox(settingsScript,PSTR("SX"),notifyDelta);
+    printSetFormValue(settingsScript,PSTR("WI"),interfaceUpdateCooldown);
 
     printSetFormCheckbox(settingsScript,PSTR("NL"),nodeListEnabled);
     printSetFormCheckbox(settingsScript,PSTR("NB"),nodeBroadcastEnabled);
@@ -524,11 +534,20 @@ void getSettingsJS(byte subPage, Print& settingsScript)
     printSetFormValue(settingsScript,PSTR("DA"),DMXAddress);
     printSetFormValue(settingsScript,PSTR("XX"),DMXSegmentSpacing);
     printSetFormValue(settingsScript,PSTR("PY"),e131Priority);
+    printSetFormValue(settingsScript,PSTR("MM"),e131MergeMode);
     printSetFormValue(settingsScript,PSTR("DM"),DMXMode);
+    printSetFormValue(settingsScript,PSTR("EOU"),e131OutUniverse);
+    printSetFormValue(settingsScript,PSTR("EOP"),e131OutPriority);
+    printSetFormCheckbox(settingsScript,PSTR("EOM"),e131OutMulticast);
+    printSetFormValue(settingsScript,PSTR("EOS"),e131OutSyncUniverse);
     printSetFormValue(settingsScript,PSTR("ET"),realtimeTimeoutMs);
     printSetFormCheckbox(settingsScript,PSTR("FB"),arlsForceMaxBri);
     printSetFormCheckbox(settingsScript,PSTR("RG"),arlsDisableGammaCorrection);
     printSetFormValue(settingsScript,PSTR("WO"),arlsOffset);
+    printSetFormValue(settingsScript,PSTR("JB"),realtimePlayoutFrames);
+    printSetFormValue(settingsScript,PSTR("RCW"),realtimeCanvasWidth);
+    printSetFormValue(settingsScript,PSTR("RCH"),realtimeCanvasHeight);
+    printSetFormCheckbox(settingsScript,PSTR("RCB"),realtimeCanvasBilinear);
     #ifndef WLED_DISABLE_ALEXA
     printSetFormCheckbox(settingsScript,PSTR("AL"),alexaEnabled);
     printSetFormValue(settingsScript,PSTR("AI"),alexaInvocationName);